@@ -172,6 +172,24 @@ namespace embree
     return AffineSpaceT<T>(lerp(M0.l,M1.l,t),lerp(M0.p,M1.p,t));
   }
 
+  // cubic evaluates the uniform Catmull-Rom spline segment between M1 and M2,
+  // M0 and M3 are the neighbouring keys that determine the tangents.
+  template<typename T, typename R>
+  __forceinline AffineSpaceT<T> cubic(const AffineSpaceT<T>& M0,
+                                      const AffineSpaceT<T>& M1,
+                                      const AffineSpaceT<T>& M2,
+                                      const AffineSpaceT<T>& M3,
+                                      const R& t)
+  {
+    /* evaluate as Bezier curve with the same end points */
+    const AffineSpaceT<T> B1 = M1 + (1.0f/6.0f)*(M2-M0);
+    const AffineSpaceT<T> B2 = M2 - (1.0f/6.0f)*(M3-M1);
+    const AffineSpaceT<T> M01 = lerp(M1,B1,t);
+    const AffineSpaceT<T> M12 = lerp(B1,B2,t);
+    const AffineSpaceT<T> M23 = lerp(B2,M2,t);
+    return lerp(lerp(M01,M12,t),lerp(M12,M23,t),t);
+  }
+
   // slerp interprets the 16 floats of the matrix M = D * R * S as components of
   // three matrizes (D, R, S) that are interpolated individually.
   template<typename T> __forceinline AffineSpaceT<LinearSpace3<Vec3<T>>>
@@ -45,6 +45,31 @@ namespace embree
     union { float f; int i; } v; v.i = i; return v.f;
   }
 
+  /* converts a half precision float to single precision */
+  __forceinline float half2float(unsigned short h)
+  {
+    const int sign = int(h & 0x8000) << 16;
+    const int exponent = (h >> 10) & 0x1F;
+    const int mantissa = h & 0x3FF;
+    if (exponent == 0)  // zero and denormals
+      return cast_i2f(sign | cast_f2i(float(mantissa)*(1.0f/16777216.0f)));
+    if (exponent == 31) // infinity and NaN
+      return cast_i2f(sign | 0x7F800000 | (mantissa << 13));
+    return cast_i2f(sign | ((exponent+112) << 23) | (mantissa << 13));
+  }
+
+  /* converts a single precision float to half precision, values too small for half precision get flushed to zero */
+  __forceinline unsigned short float2half(float f)
+  {
+    const int i = cast_f2i(f);
+    const unsigned short sign = (unsigned short)((i >> 16) & 0x8000);
+    const int exponent = ((i >> 23) & 0xFF) - 112;
+    const int mantissa = i & 0x7FFFFF;
+    if (exponent <= 0)  return sign;
+    if (exponent >= 31) return sign | 0x7C00 | ((exponent == 143 && mantissa) ? 0x200 : 0);
+    return sign | (unsigned short)(((exponent << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1));
+  }
+
   __forceinline int   toInt  (const float& a) { return int(a); }
   __forceinline float toFloat(const int&   a) { return float(a); }
 
@@ -28,6 +28,7 @@ enum RTCBufferType
   RTC_BUFFER_TYPE_HOLE                 = 22,
 
   RTC_BUFFER_TYPE_TRANSFORM            = 23,
+  RTC_BUFFER_TYPE_TRANSFORM_PALETTE    = 24,
 
   RTC_BUFFER_TYPE_FLAGS = 32
 };
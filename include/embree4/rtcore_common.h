@@ -150,6 +150,11 @@ enum RTCFormat
   RTC_FORMAT_GRID = 0xA001,
 
   RTC_FORMAT_QUATERNION_DECOMPOSITION = 0xB001,
+
+  /* compressed instance transformations */
+  RTC_FORMAT_TRANSLATION_FLOAT3 = 0xB002,
+  RTC_FORMAT_TRANSLATION_PALETTE_INDEX = 0xB003,
+  RTC_FORMAT_HALF3X4_COLUMN_MAJOR = 0xB004,
 };
 
 /* Build quality levels */
@@ -473,6 +478,21 @@ struct RTC_ALIGN(16) RTCPointQueryFunctionArguments
 
 typedef bool (*RTCPointQueryFunction)(struct RTCPointQueryFunctionArguments* args);
 
+/* Neighbor found by a k nearest neighbor point query */
+struct RTC_ALIGN(16) RTCPointQueryNeighbor
+{
+  float x;                // x coordinate of the closest point on the primitive
+  float y;                // y coordinate of the closest point on the primitive
+  float z;                // z coordinate of the closest point on the primitive
+  float distance;         // distance of the closest point to the query point
+  unsigned int primID;    // primitive ID
+  unsigned int geomID;    // geometry ID
+  unsigned int instID[RTC_MAX_INSTANCE_LEVEL_COUNT]; // instance ID
+#if defined(RTC_GEOMETRY_INSTANCE_ARRAY)
+  unsigned int instPrimID[RTC_MAX_INSTANCE_LEVEL_COUNT]; // instance primitive ID
+#endif
+};
+
 #if defined(EMBREE_SYCL_SUPPORT) && defined(SYCL_LANGUAGE_VERSION)
 
 /* returns function pointer to be usable in SYCL kernel */
@@ -62,6 +62,21 @@ enum RTCSubdivisionMode
   RTC_SUBDIVISION_MODE_PIN_ALL         = 4,
 };
 
+/* Interpolation modes for the transformations of instances */
+enum RTCTransformInterpolation
+{
+  RTC_TRANSFORM_INTERPOLATION_LINEAR = 0,
+  RTC_TRANSFORM_INTERPOLATION_CUBIC  = 1,
+};
+
+/* Texel formats of built-in alpha masks */
+enum RTCAlphaMaskFormat
+{
+  RTC_ALPHA_MASK_FORMAT_UNDEFINED = 0,
+  RTC_ALPHA_MASK_FORMAT_BIT       = 1,
+  RTC_ALPHA_MASK_FORMAT_UCHAR     = 2,
+};
+
 /* Curve segment flags */
 enum RTCCurveFlags
 {
@@ -105,6 +120,38 @@ struct RTCOccludedFunctionNArguments
   unsigned int geomID;
 };
 
+/* Arguments for RTCIntersectFunctionBatch */
+struct RTCIntersectFunctionBatchArguments
+{
+  int* valid;
+  void* geometryUserPtr;
+  const unsigned int* primIDs;
+  unsigned int numPrims;
+  struct RTCRayQueryContext* context;
+  struct RTCRayHitN* rayhit;
+  unsigned int N;
+  unsigned int geomID;
+};
+
+/* Batched intersection callback function */
+typedef void (*RTCIntersectFunctionBatch)(const struct RTCIntersectFunctionBatchArguments* args);
+
+/* Arguments for RTCOccludedFunctionBatch */
+struct RTCOccludedFunctionBatchArguments
+{
+  int* valid;
+  void* geometryUserPtr;
+  const unsigned int* primIDs;
+  unsigned int numPrims;
+  struct RTCRayQueryContext* context;
+  struct RTCRayN* ray;
+  unsigned int N;
+  unsigned int geomID;
+};
+
+/* Batched occlusion callback function */
+typedef void (*RTCOccludedFunctionBatch)(const struct RTCOccludedFunctionBatchArguments* args);
+
 /* Arguments for RTCDisplacementFunctionN */
 struct RTCDisplacementFunctionNArguments
 {
@@ -164,6 +211,12 @@ RTC_API void rtcSetGeometryBuildQuality(RTCGeometry geometry, enum RTCBuildQuali
 /* Sets the maximal curve or point radius scale allowed by min-width feature. */
 RTC_API void rtcSetGeometryMaxRadiusScale(RTCGeometry geometry, float maxRadiusScale);
 
+/* Sets the ray distance range in which the geometry is visible. */
+RTC_API void rtcSetGeometryLODRange(RTCGeometry geometry, float nearDistance, float farDistance);
+
+/* Creates a flat curve geometry that approximates a committed curve geometry with fewer segments and strands. */
+RTC_API RTCGeometry rtcNewCurveLODGeometry(RTCGeometry geometry, unsigned int segmentReduction, unsigned int strandsPerRibbon);
+
 
 /* Sets a geometry buffer. */
 RTC_API void rtcSetGeometryBuffer(RTCGeometry geometry, enum RTCBufferType type, unsigned int slot, enum RTCFormat format, RTCBuffer buffer, size_t byteOffset, size_t byteStride, size_t itemCount);
@@ -180,6 +233,9 @@ RTC_API void* rtcGetGeometryBufferData(RTCGeometry geometry, enum RTCBufferType
 /* Updates a geometry buffer. */
 RTC_API void rtcUpdateGeometryBuffer(RTCGeometry geometry, enum RTCBufferType type, unsigned int slot);
 
+/* Updates a range of items of a geometry buffer. */
+RTC_API void rtcUpdateGeometryBufferRange(RTCGeometry geometry, enum RTCBufferType type, unsigned int slot, size_t itemOffset, size_t itemCount);
+
 
 /* Sets the intersection filter callback function of the geometry. */
 RTC_API void rtcSetGeometryIntersectFilterFunction(RTCGeometry geometry, RTCFilterFunctionN filter);
@@ -187,6 +243,9 @@ RTC_API void rtcSetGeometryIntersectFilterFunction(RTCGeometry geometry, RTCFilt
 /* Sets the occlusion filter callback function of the geometry. */
 RTC_API void rtcSetGeometryOccludedFilterFunction(RTCGeometry geometry, RTCFilterFunctionN filter);
 
+/* Sets the built-in alpha mask of a triangle or quad mesh. */
+RTC_API void rtcSetGeometryAlphaMask(RTCGeometry geometry, enum RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff);
+
 /* Enables argument version of intersection or occlusion filter function. */
 RTC_API void rtcSetGeometryEnableFilterFunctionFromArguments(RTCGeometry geometry, bool enable);
 
@@ -211,6 +270,12 @@ RTC_API void rtcSetGeometryIntersectFunction(RTCGeometry geometry, RTCIntersectF
 /* Set the occlusion callback function of a user geometry. */
 RTC_API void rtcSetGeometryOccludedFunction(RTCGeometry geometry, RTCOccludedFunctionN occluded);
 
+/* Set the batched intersect callback function of a user geometry. */
+RTC_API void rtcSetGeometryIntersectFunctionBatch(RTCGeometry geometry, RTCIntersectFunctionBatch intersect);
+
+/* Set the batched occlusion callback function of a user geometry. */
+RTC_API void rtcSetGeometryOccludedFunctionBatch(RTCGeometry geometry, RTCOccludedFunctionBatch occluded);
+
 /* Invokes the intersection filter from the intersection callback function. */
 RTC_SYCL_API void rtcInvokeIntersectFilterFromGeometry(const struct RTCIntersectFunctionNArguments* args, const struct RTCFilterFunctionNArguments* filterArgs);
 
@@ -229,6 +294,9 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry geometry, unsigned int timeStep
 /* Sets the transformation quaternion of an instance for the specified time step. */
 RTC_API void rtcSetGeometryTransformQuaternion(RTCGeometry geometry, unsigned int timeStep, const struct RTCQuaternionDecomposition* qd);
 
+/* Sets how the transformations of an instance get interpolated between time steps. */
+RTC_API void rtcSetGeometryTransformInterpolation(RTCGeometry geometry, enum RTCTransformInterpolation interpolation);
+
 /* Returns the interpolated transformation of an instance for the specified time. */
 RTC_API void rtcGetGeometryTransform(RTCGeometry geometry, float time, enum RTCFormat format, void* xfm);
 
@@ -242,6 +310,12 @@ RTC_API void rtcGetGeometryTransformEx(RTCGeometry geometry, unsigned int instPr
 /* Sets the uniform tessellation rate of the geometry. */
 RTC_API void rtcSetGeometryTessellationRate(RTCGeometry geometry, float tessellationRate);
 
+/* Sets the camera position and rate used to calculate adaptive edge levels of the geometry. */
+RTC_API void rtcSetGeometryTessellationCamera(RTCGeometry geometry, float x, float y, float z, float rate);
+
+/* Sets the maximal displacement of the geometry. */
+RTC_API void rtcSetGeometryMaxDisplacement(RTCGeometry geometry, float maxDisplacement);
+
 /* Sets the number of topologies of a subdivision surface. */
 RTC_API void rtcSetGeometryTopologyCount(RTCGeometry geometry, unsigned int topologyCount);
 
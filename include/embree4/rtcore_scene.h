@@ -155,6 +155,18 @@ RTC_API bool rtcPointQuery8(const int* valid, RTCScene scene, struct RTCPointQue
 /* Perform a closest point query with a packet of 4 points with the scene. */
 RTC_API bool rtcPointQuery16(const int* valid, RTCScene scene, struct RTCPointQuery16* query, struct RTCPointQueryContext* context, RTCPointQueryFunction queryFunc, void** userPtr);
 
+/* Finds the k nearest neighbors of the query point, returns the number of neighbors found. */
+RTC_API unsigned int rtcPointQueryKNN(RTCScene scene, struct RTCPointQuery* query, unsigned int k, struct RTCPointQueryNeighbor* neighbors);
+
+/* Finds the k nearest neighbors for a packet of 4 query points. */
+RTC_API void rtcPointQueryKNN4(const int* valid, RTCScene scene, struct RTCPointQuery4* query, unsigned int k, struct RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors);
+
+/* Finds the k nearest neighbors for a packet of 8 query points. */
+RTC_API void rtcPointQueryKNN8(const int* valid, RTCScene scene, struct RTCPointQuery8* query, unsigned int k, struct RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors);
+
+/* Finds the k nearest neighbors for a packet of 16 query points. */
+RTC_API void rtcPointQueryKNN16(const int* valid, RTCScene scene, struct RTCPointQuery16* query, unsigned int k, struct RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors);
+
 
 /* Intersects a single ray with the scene. */
 RTC_SYCL_API void rtcIntersect1(RTCScene scene, struct RTCRayHit* rayhit, struct RTCIntersectArguments* args RTC_OPTIONAL_ARGUMENT);
@@ -168,6 +180,15 @@ RTC_API void rtcIntersect8(const int* valid, RTCScene scene, struct RTCRayHit8*
 /* Intersects a packet of 16 rays with the scene. */
 RTC_API void rtcIntersect16(const int* valid, RTCScene scene, struct RTCRayHit16* rayhit, struct RTCIntersectArguments* args RTC_OPTIONAL_ARGUMENT);
 
+/* Intersects a coherent tile of ray packets of size 4 with the scene. */
+RTC_API void rtcIntersectTile4(const int* valid, RTCScene scene, struct RTCRayHit4* rayhits, unsigned int numPackets, struct RTCIntersectArguments* args RTC_OPTIONAL_ARGUMENT);
+
+/* Intersects a coherent tile of ray packets of size 8 with the scene. */
+RTC_API void rtcIntersectTile8(const int* valid, RTCScene scene, struct RTCRayHit8* rayhits, unsigned int numPackets, struct RTCIntersectArguments* args RTC_OPTIONAL_ARGUMENT);
+
+/* Intersects a coherent tile of ray packets of size 16 with the scene. */
+RTC_API void rtcIntersectTile16(const int* valid, RTCScene scene, struct RTCRayHit16* rayhits, unsigned int numPackets, struct RTCIntersectArguments* args RTC_OPTIONAL_ARGUMENT);
+
 
 /* Forwards ray inside user geometry callback. */
 RTC_SYCL_API void rtcForwardIntersect1(const struct RTCIntersectFunctionNArguments* args, RTCScene scene, struct RTCRay* ray, unsigned int instID);
@@ -206,6 +227,15 @@ RTC_API void rtcOccluded8(const int* valid, RTCScene scene, struct RTCRay8* ray,
 /* Tests a packet of 16 rays for occlusion with the scene. */
 RTC_API void rtcOccluded16(const int* valid, RTCScene scene, struct RTCRay16* ray, struct RTCOccludedArguments* args RTC_OPTIONAL_ARGUMENT);
 
+/* Tests a coherent tile of ray packets of size 4 for occlusion with the scene. */
+RTC_API void rtcOccludedTile4(const int* valid, RTCScene scene, struct RTCRay4* rays, unsigned int numPackets, struct RTCOccludedArguments* args RTC_OPTIONAL_ARGUMENT);
+
+/* Tests a coherent tile of ray packets of size 8 for occlusion with the scene. */
+RTC_API void rtcOccludedTile8(const int* valid, RTCScene scene, struct RTCRay8* rays, unsigned int numPackets, struct RTCOccludedArguments* args RTC_OPTIONAL_ARGUMENT);
+
+/* Tests a coherent tile of ray packets of size 16 for occlusion with the scene. */
+RTC_API void rtcOccludedTile16(const int* valid, RTCScene scene, struct RTCRay16* rays, unsigned int numPackets, struct RTCOccludedArguments* args RTC_OPTIONAL_ARGUMENT);
+
 
 /* Forwards single occlusion ray inside user geometry callback. */
 RTC_SYCL_API void rtcForwardOccluded1(const struct RTCOccludedFunctionNArguments* args, RTCScene scene, struct RTCRay* ray, unsigned int instID);
@@ -232,6 +262,28 @@ RTC_API void rtcForwardOccluded16(const int* valid, const struct RTCOccludedFunc
 RTC_API void rtcForwardOccluded16Ex(const int* valid, const struct RTCOccludedFunctionNArguments* args, RTCScene scene, struct RTCRay16* ray, unsigned int instID, unsigned int instPrimID);
 
 
+/* Per thread traversal context that caches the scene state used by many single ray queries */
+struct RTCTraversalContext
+{
+  RTCScene scene;                              // scene the context got initialized for
+  struct RTCIntersectArguments intersectArgs;  // arguments used by rtcIntersectWithContext
+  struct RTCOccludedArguments occludedArgs;    // arguments used by rtcOccludedWithContext
+  struct RTCRayQueryContext queryContext;      // ray query context used if the arguments do not specify one
+  void* intersectors;                          // internal: intersectors of the scene
+  void* intersect;                             // internal: selected single ray intersection function
+  void* occluded;                              // internal: selected single ray occlusion function
+};
+
+/* Initializes a traversal context for the committed scene. */
+RTC_API void rtcInitTraversalContext(struct RTCTraversalContext* context, RTCScene scene, struct RTCIntersectArguments* iargs RTC_OPTIONAL_ARGUMENT, struct RTCOccludedArguments* oargs RTC_OPTIONAL_ARGUMENT);
+
+/* Intersects a single ray with the scene of the traversal context. */
+RTC_API void rtcIntersectWithContext(struct RTCTraversalContext* context, struct RTCRayHit* rayhit);
+
+/* Tests a single ray for occlusion with the scene of the traversal context. */
+RTC_API void rtcOccludedWithContext(struct RTCTraversalContext* context, struct RTCRay* ray);
+
+
 /*! collision callback */
 struct RTCCollision { unsigned int geomID0; unsigned int primID0; unsigned int geomID1; unsigned int primID1; };
 typedef void (*RTCCollideFunc) (void* userPtr, struct RTCCollision* collisions, unsigned int num_collisions);
@@ -23,7 +23,7 @@ namespace embree
       {
         /*! default settings */
         Settings ()
-        : branchingFactor(2), maxDepth(32), logBlockSize(0), minLeafSize(1), maxLeafSize(7), finished_range_threshold(inf) {}
+        : branchingFactor(2), maxDepth(32), logBlockSize(0), minLeafSize(1), maxLeafSize(7), finished_range_threshold(inf), splitPrims(false) {}
 
       public:
         size_t branchingFactor;  //!< branching factor of BVH to build
@@ -32,6 +32,7 @@ namespace embree
         size_t minLeafSize;      //!< minimum size of a leaf
         size_t maxLeafSize;      //!< maximum size of a leaf
         size_t finished_range_threshold;  //!< finished range threshold
+        bool splitPrims;         //!< primrefs might reference only a part of a curve
       };
 
       template<typename NodeRef,
@@ -84,7 +85,7 @@ namespace embree
             createLeaf(createLeaf),
             progressMonitor(progressMonitor),
             reportFinishedRange(reportFinishedRange),
-            alignedHeuristic(prims), unalignedHeuristic(scene,prims), strandHeuristic(scene,prims) {}
+            alignedHeuristic(prims), unalignedHeuristic(scene,prims,settings.splitPrims), strandHeuristic(scene,prims,settings.splitPrims) {}
 
           /*! checks if all primitives are from the same geometry */
           __forceinline bool sameGeometry(const PrimInfoRange& range)
@@ -99,6 +100,21 @@ namespace embree
             return true;
           }
 
+          /*! removes multiple references to the same curve from a leaf, which can occur when curves got split */
+          __forceinline range<size_t> removeDuplicates(const range<size_t>& set)
+          {
+            if (likely(!cfg.splitPrims)) return set;
+            size_t end = set.begin();
+            for (size_t i=set.begin(); i<set.end(); i++)
+            {
+              bool duplicate = false;
+              for (size_t j=set.begin(); j<end; j++)
+                duplicate |= prims[j].ID64() == prims[i].ID64();
+              if (!duplicate) prims[end++] = prims[i];
+            }
+            return range<size_t>(set.begin(),end);
+          }
+
           /*! creates a large leaf that could be larger than supported by the BVH */
           NodeRef createLargeLeaf(size_t depth, const PrimInfoRange& pinfo, Allocator alloc)
           {
@@ -108,7 +124,7 @@ namespace embree
 
             /* create leaf for few primitives */
             if (pinfo.size() <= cfg.maxLeafSize && sameGeometry(pinfo))
-              return createLeaf(prims,pinfo,alloc);
+              return createLeaf(prims,removeDuplicates(pinfo),alloc);
 
             /* fill all children by always splitting the largest one */
             PrimInfoRange children[MAX_BRANCHING_FACTOR];
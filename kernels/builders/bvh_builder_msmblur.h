@@ -3,7 +3,7 @@
 
 #pragma once
 
-#define MBLUR_NUM_TEMPORAL_BINS 2
+#define MBLUR_NUM_TEMPORAL_BINS 4
 #define MBLUR_NUM_OBJECT_BINS   32
 
 #include "../bvh/bvh.h"
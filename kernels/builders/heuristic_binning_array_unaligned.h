@@ -18,11 +18,19 @@ namespace embree
         typedef range<size_t> Set;
 
         __forceinline UnalignedHeuristicArrayBinningSAH () // FIXME: required?
-          : scene(nullptr), prims(nullptr) {}
+          : scene(nullptr), prims(nullptr), splitPrims(false) {}
         
         /*! remember prim array */
-        __forceinline UnalignedHeuristicArrayBinningSAH (Scene* scene, PrimRef* prims)
-          : scene(scene), prims(prims) {}
+        __forceinline UnalignedHeuristicArrayBinningSAH (Scene* scene, PrimRef* prims, bool splitPrims = false)
+          : scene(scene), prims(prims), splitPrims(splitPrims) {}
+
+        /*! returns bounds of the primitive in the specified space, primrefs of split curves bound only a part of the curve */
+        static __forceinline BBox3fa primBounds(Scene* scene, bool splitPrims, const LinearSpace3fa& space, const PrimRef& ref)
+        {
+          const BBox3fa bounds = scene->get(ref.geomID())->vbounds(space,ref.primID());
+          if (likely(!splitPrims)) return bounds;
+          return intersect(bounds,xfmBounds(AffineSpace3fa(space),ref.bounds()));
+        }
 
         const LinearSpace3fa computeAlignedSpace(const range<size_t>& set)
         {
@@ -50,10 +58,8 @@ namespace embree
           auto computeBounds = [&](const range<size_t>& r) -> CentGeomBBox3fa
             {
               CentGeomBBox3fa bounds(empty);
-              for (size_t i=r.begin(); i<r.end(); i++) {
-                Geometry* mesh = scene->get(prims[i].geomID());
-                bounds.extend(mesh->vbounds(space,prims[i].primID()));
-              }
+              for (size_t i=r.begin(); i<r.end(); i++)
+                bounds.extend(primBounds(scene,splitPrims,space,prims[i]));
               return bounds;
             };
           
@@ -65,28 +71,27 @@ namespace embree
 
         struct BinBoundsAndCenter
         {
-          __forceinline BinBoundsAndCenter(Scene* scene, const LinearSpace3fa& space)
-            : scene(scene), space(space) {}
+          __forceinline BinBoundsAndCenter(Scene* scene, bool splitPrims, const LinearSpace3fa& space)
+            : scene(scene), splitPrims(splitPrims), space(space) {}
           
             /*! returns center for binning */
           __forceinline Vec3fa binCenter(const PrimRef& ref) const
           {
-            Geometry* mesh = (Geometry*) scene->get(ref.geomID());
-            BBox3fa bounds = mesh->vbounds(space,ref.primID());
+            BBox3fa bounds = primBounds(scene,splitPrims,space,ref);
             return embree::center2(bounds);
           }
           
           /*! returns bounds and centroid used for binning */
           __forceinline void binBoundsAndCenter(const PrimRef& ref, BBox3fa& bounds_o, Vec3fa& center_o) const
           {
-            Geometry* mesh = (Geometry*) scene->get(ref.geomID());
-            BBox3fa bounds = mesh->vbounds(space,ref.primID());
+            BBox3fa bounds = primBounds(scene,splitPrims,space,ref);
             bounds_o = bounds;
             center_o = embree::center2(bounds);
           }
 
         private:
           Scene* scene;
+          bool splitPrims;
           const LinearSpace3fa space;
         };
         
@@ -105,7 +110,7 @@ namespace embree
         {
           Binner binner(empty);
           const BinMapping<BINS> mapping(set);
-          BinBoundsAndCenter binBoundsAndCenter(scene,space);
+          BinBoundsAndCenter binBoundsAndCenter(scene,splitPrims,space);
           bin_serial_or_parallel<parallel>(binner,prims,set.begin(),set.end(),size_t(4096),mapping,binBoundsAndCenter);
           return binner.best(mapping,logBlockSize);
         }
@@ -134,7 +139,7 @@ namespace embree
           CentGeomBBox3fa local_right(empty);
           const int splitPos = split.pos;
           const int splitDim = split.dim;
-          BinBoundsAndCenter binBoundsAndCenter(scene,space);
+          BinBoundsAndCenter binBoundsAndCenter(scene,splitPrims,space);
 
           size_t center = 0;
           if (likely(set.size() < 10000))
@@ -180,6 +185,7 @@ namespace embree
       private:
         Scene* const scene;
         PrimRef* const prims;
+        bool splitPrims; //!< primrefs might bound only a part of a curve
       };
 
     /*! Performs standard object binning */
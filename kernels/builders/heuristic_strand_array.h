@@ -43,22 +43,25 @@ namespace embree
       };
 
       __forceinline HeuristicStrandSplit () // FIXME: required?
-        : scene(nullptr), prims(nullptr) {}
+        : scene(nullptr), prims(nullptr), splitPrims(false) {}
       
       /*! remember prim array */
-      __forceinline HeuristicStrandSplit (Scene* scene, PrimRef* prims)
-        : scene(scene), prims(prims) {}
+      __forceinline HeuristicStrandSplit (Scene* scene, PrimRef* prims, bool splitPrims = false)
+        : scene(scene), prims(prims), splitPrims(splitPrims) {}
       
       __forceinline const Vec3fa direction(const PrimRef& prim) {
         return scene->get(prim.geomID())->computeDirection(prim.primID());
       }
       
       __forceinline const BBox3fa bounds(const PrimRef& prim) {
+        if (unlikely(splitPrims)) return prim.bounds();
         return scene->get(prim.geomID())->vbounds(prim.primID());
       }
 
       __forceinline const BBox3fa bounds(const LinearSpace3fa& space, const PrimRef& prim) {
-        return scene->get(prim.geomID())->vbounds(space,prim.primID());
+        const BBox3fa bounds = scene->get(prim.geomID())->vbounds(space,prim.primID());
+        if (likely(!splitPrims)) return bounds;
+        return intersect(bounds,xfmBounds(AffineSpace3fa(space),prim.bounds()));
       }
 
       /*! finds the best split */
@@ -183,6 +186,7 @@ namespace embree
     private:
       Scene* const scene;
       PrimRef* const prims;
+      bool splitPrims; //!< primrefs might bound only a part of a curve
     };
   }
 }
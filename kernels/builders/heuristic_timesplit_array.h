@@ -41,15 +41,23 @@ namespace embree
             }
           }
           
+          /*! returns the split time of the b'th bin aligned to the time steps, bins outside the time
+           *  range or aligned to the same time step as the previous bin return the lower time bound */
+          static __forceinline float binTime(int b, BBox1f time_range, const SetMB& set)
+          {
+            const float center_time = set.align_time(lerp(time_range.lower,time_range.upper,float(b+1)/float(BINS)));
+            if (center_time <= time_range.lower) return time_range.lower;
+            if (center_time >= time_range.upper) return time_range.lower;
+            if (b > 0 && center_time == set.align_time(lerp(time_range.lower,time_range.upper,float(b)/float(BINS)))) return time_range.lower;
+            return center_time;
+          }
+
           void bin(const PrimRefMB* prims, size_t begin, size_t end, BBox1f time_range, const SetMB& set, const RecalculatePrimRef& recalculatePrimRef)
           {
             for (int b=0; b<BINS-1; b++)
             {
-              const float t = float(b+1)/float(BINS);
-              const float ct = lerp(time_range.lower,time_range.upper,t);
-              const float center_time = set.align_time(ct);
+              const float center_time = binTime(b,time_range,set);
               if (center_time <= time_range.lower) continue;
-              if (center_time >= time_range.upper) continue;
               const BBox1f dt0(time_range.lower,center_time);
               const BBox1f dt1(center_time,time_range.upper);
               
@@ -117,11 +125,8 @@ namespace embree
             float bestPos = 0.0f;
             for (int b=0; b<BINS-1; b++)
             {
-              float t = float(b+1)/float(BINS);
-              float ct = lerp(time_range.lower,time_range.upper,t);
-              const float center_time = set.align_time(ct);
+              const float center_time = binTime(b,time_range,set);
               if (center_time <= time_range.lower) continue;
-              if (center_time >= time_range.upper) continue;
               const BBox1f dt0(time_range.lower,center_time);
               const BBox1f dt1(center_time,time_range.upper);
               
@@ -251,11 +251,9 @@ namespace embree
           PrimInfo pinfo(empty);
           for (size_t j=r.begin(); j<r.end(); j++)
           {
-            if (!mesh->valid(j)) continue;
             BBox3fa bounds = empty;
             const PrimRef prim(bounds,(unsigned)geomID,(unsigned)j);
-            if (!mesh->valid(j)) continue;
-            pinfo.add_center2(prim,mesh->getNumSubGrids(j));
+            pinfo.add_center2(prim,mesh->getNumValidSubGrids(j));
           }
           return pinfo;
         }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo::merge(a,b); });
@@ -287,10 +285,9 @@ namespace embree
                                      PrimInfo pinfo(empty);
                                      for (size_t j=r.begin(); j<r.end(); j++)
                                      {
-                                       if (!mesh->valid(j)) continue;
                                        BBox3fa bounds = empty;
                                        const PrimRef prim(bounds,geomID_,unsigned(j));
-                                       pinfo.add_center2(prim,mesh->getNumSubGrids(j));
+                                       pinfo.add_center2(prim,mesh->getNumValidSubGrids(j));
                                      }
                                      return pinfo;
                                    }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo::merge(a,b); });
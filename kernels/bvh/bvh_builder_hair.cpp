@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "../builders/bvh_builder_hair.h"
+#include "../builders/bvh_builder_morton.h"
 #include "../builders/primrefgen.h"
+#include "../../common/algorithms/parallel_for_for_prefix_sum.h"
 
 #include "../geometry/pointi.h"
 #include "../geometry/linei.h"
@@ -21,6 +23,9 @@ namespace embree
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
+      static const unsigned int MAX_CURVE_SPLITS = 4;   //!< maximal number of primrefs a curve gets split into
+      static constexpr float CURVE_SPLIT_COST = 0.15f;  //!< cost of an additional primref relative to the unsplit curve
+
       BVH* bvh;
       Scene* scene;
       mvector<PrimRef> prims;
@@ -45,9 +50,27 @@ namespace embree
 
         double t0 = bvh->preBuild(TOSTRING(isa) "::BVH" + toString(N) + "HairBuilderSAH");
 
+        /* low quality builds of point clouds sort the points on morton codes directly instead of creating primrefs */
+        if (scene->quality_flags == RTC_BUILD_QUALITY_LOW &&
+            scene->getNumPrimitives(Geometry::MTY_POINTS,false) == numPrimitives &&
+            numPrimitives <= size_t(std::numeric_limits<unsigned int>::max()))
+        {
+          prims.clear();
+          settings.finished_range_threshold = inf;
+          buildPointsMorton();
+          bvh->cleanup();
+          bvh->postBuild(t0);
+          return;
+        }
+
         /* create primref array */
         prims.resize(numPrimitives);
-        const PrimInfo pinfo = createPrimRefArray(scene,Geometry::MTY_CURVES,false,numPrimitives,prims,scene->progressInterface);
+        PrimInfo pinfo = createPrimRefArray(scene,Geometry::MTY_CURVES,false,numPrimitives,prims,scene->progressInterface);
+
+        /* high quality builds split curved segments to get tighter bounds */
+        settings.splitPrims = false;
+        if (scene->quality_flags == RTC_BUILD_QUALITY_HIGH)
+          pinfo = splitCurves(pinfo);
 
         /* estimate acceleration structure size */
         const size_t node_bytes = pinfo.size()*sizeof(typename BVH::OBBNode)/(4*N);
@@ -112,6 +135,211 @@ namespace embree
         bvh->postBuild(t0);
       }
 
+      /*! builds the BVH over all point geometries using the morton builder */
+      void buildPointsMorton()
+      {
+        typedef typename BVH::AABBNode AABBNode;
+        typedef typename BVH::NodeRecord NodeRecord;
+        Scene::Iterator2 iter(scene,Geometry::MTY_POINTS,false);
+
+        /* the 32 bit index of a morton build primitive is the point ID offset by the points of all previous geometries */
+        std::vector<unsigned int> offsets(scene->size()+1);
+        offsets[0] = 0;
+        for (size_t i=0; i<scene->size(); i++)
+          offsets[i+1] = offsets[i] + (iter[i] ? (unsigned int) iter[i]->size() : 0);
+
+        auto decode = [&] (const unsigned int index, unsigned int& geomID, unsigned int& primID) {
+          geomID = (unsigned int) (std::upper_bound(offsets.begin(),offsets.end(),index)-offsets.begin()-1);
+          primID = index-offsets[geomID];
+        };
+
+        /* calculate centroid bounds of all valid points */
+        ParallelForForPrefixSumState<PrimInfo> pstate;
+        scene->progressInterface(0);
+        pstate.init(iter,size_t(1024));
+        const PrimInfo pinfo = parallel_for_for_prefix_sum0( pstate, iter, PrimInfo(empty), [&](Geometry* geom, const range<size_t>& r, size_t k, size_t geomID) -> PrimInfo
+        {
+          const Points* points = (const Points*) geom;
+          PrimInfo pinfo(empty);
+          for (size_t j=r.begin(); j<r.end(); j++) {
+            BBox3fa bounds = empty;
+            if (!points->buildBounds(j,&bounds)) continue;
+            pinfo.add_center2(PrimRef(bounds,(unsigned int)geomID,(unsigned int)j));
+          }
+          return pinfo;
+        }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo::merge(a,b); });
+
+        if (pinfo.size() == 0) {
+          bvh->set(BVH::emptyNode,empty,0);
+          return;
+        }
+
+        /* create morton codes of valid points */
+        mvector<BVHBuilderMorton::BuildPrim> morton(scene->device,pinfo.size());
+        mvector<BVHBuilderMorton::BuildPrim> morton_tmp(scene->device,pinfo.size());
+        const BVHBuilderMorton::MortonCodeMapping mapping(pinfo.centBounds);
+        parallel_for_for_prefix_sum1( pstate, iter, PrimInfo(empty), [&](Geometry* geom, const range<size_t>& r, size_t k, size_t geomID, const PrimInfo& base) -> PrimInfo
+        {
+          const Points* points = (const Points*) geom;
+          BVHBuilderMorton::MortonCodeGenerator generator(mapping,&morton.data()[base.size()]);
+          PrimInfo pinfo(empty);
+          for (size_t j=r.begin(); j<r.end(); j++) {
+            BBox3fa bounds = empty;
+            if (!points->buildBounds(j,&bounds)) continue;
+            generator(bounds,offsets[geomID]+(unsigned int)j);
+            pinfo.add_center2(PrimRef(bounds,(unsigned int)geomID,(unsigned int)j));
+          }
+          return pinfo;
+        }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo::merge(a,b); });
+
+        /* estimate acceleration structure size */
+        const size_t node_bytes = pinfo.size()*sizeof(AABBNode)/(4*N);
+        const size_t leaf_bytes = size_t(1.2f*PointPrimitive::bytes(pinfo.size()));
+        bvh->alloc.init_estimate(node_bytes+leaf_bytes);
+
+        auto setBounds = [&] (NodeRef ref, const NodeRecord* children, size_t num) -> NodeRecord
+        {
+          AABBNode* node = ref.getAABBNode();
+          BBox3fa bounds = empty;
+          for (size_t i=0; i<num; i++) {
+            const BBox3fa b = children[i].bounds;
+            node->setRef(i,children[i].ref);
+            node->setBounds(i,b);
+            bounds.extend(b);
+          }
+          node->setOctantOrder();
+          return NodeRecord(ref,bounds);
+        };
+
+        /* the curve intersectors expect a single block per leaf, thus points of different geometries get separate leaves below an extra node */
+        const size_t maxLeafSize = min(size_t(N),PointPrimitive::max_size());
+        auto createLeaf = [&] (const range<unsigned>& current, const FastAllocator::CachedAllocator& alloc) -> NodeRecord
+        {
+          PrimRef leafPrims[N];
+          assert(current.size() <= maxLeafSize);
+          const size_t items = min(size_t(current.size()),size_t(N));
+
+          /* insertion sort of the few leaf points by geomID */
+          for (size_t i=0; i<items; i++) {
+            unsigned int geomID, primID;
+            decode(morton[current.begin()+i].index,geomID,primID);
+            size_t j = i;
+            for (; j>0 && leafPrims[j-1].geomID() > geomID; j--)
+              leafPrims[j] = leafPrims[j-1];
+            leafPrims[j] = PrimRef(scene->get<Points>(geomID)->bounds(primID),geomID,primID);
+          }
+
+          NodeRecord children[N];
+          size_t numChildren = 0;
+          for (size_t begin=0; begin<items; numChildren++)
+          {
+            BBox3fa bounds = empty;
+            size_t end = begin;
+            while (end < items && leafPrims[end].geomID() == leafPrims[begin].geomID())
+              bounds.extend(leafPrims[end++].bounds());
+
+            PointPrimitive* accel = (PointPrimitive*) alloc.malloc1(sizeof(PointPrimitive),PointPrimitive::max_size()*sizeof(float));
+            accel->fill(leafPrims,begin,end,scene);
+            children[numChildren] = NodeRecord(bvh->encodeLeaf((char*)accel,1),bounds);
+          }
+          if (numChildren == 1)
+            return children[0];
+
+          return setBounds(typename BVH::AABBNode::Create()(alloc),children,numChildren);
+        };
+
+        auto calculateBounds = [&] (const BVHBuilderMorton::BuildPrim& prim) -> BBox3fa {
+          unsigned int geomID, primID;
+          decode(prim.index,geomID,primID);
+          return scene->get<Points>(geomID)->bounds(primID);
+        };
+
+        const BVHBuilderMorton::Settings mortonSettings(N,BVH::maxBuildDepth,maxLeafSize,maxLeafSize,DEFAULT_SINGLE_THREAD_THRESHOLD);
+        const NodeRecord root = BVHBuilderMorton::build<NodeRecord>
+          (typename BVH::CreateAlloc(bvh),
+           typename BVH::AABBNode::Create(),
+           setBounds,createLeaf,calculateBounds,scene->progressInterface,
+           morton.data(),morton_tmp.data(),pinfo.size(),mortonSettings);
+
+        bvh->set(root.ref,LBBox3fa(root.bounds),pinfo.size());
+      }
+
+      /*! splits curved segments into multiple primrefs that each bound a part of the curve only */
+      PrimInfo splitCurves(const PrimInfo& pinfo)
+      {
+        /* determine number of parts of each curve by evaluating the bounds in the space of the curve */
+        const size_t numPrims = pinfo.size();
+        std::vector<unsigned int> numParts(numPrims+1);
+        parallel_for(size_t(0), numPrims, size_t(1024), [&] (const range<size_t>& r)
+        {
+          for (size_t i=r.begin(); i<r.end(); i++)
+          {
+            numParts[i] = 1;
+            const Geometry* geom = scene->get(prims[i].geomID());
+            if (!(geom->getTypeMask() & Geometry::MTY_CURVE4)) continue;
+
+            const unsigned int primID = prims[i].primID();
+            const LinearSpace3fa space = geom->computeAlignedSpace(primID);
+            const float cost1 = halfArea(geom->vbounds(space,primID,BBox1f(0.0f,1.0f)));
+            float bestCost = cost1;
+            for (unsigned int n=2; n<=MAX_CURVE_SPLITS; n*=2)
+            {
+              float cost = float(n-1)*CURVE_SPLIT_COST*cost1;
+              for (unsigned int k=0; k<n; k++)
+                cost += halfArea(geom->vbounds(space,primID,BBox1f(float(k+0)/float(n),float(k+1)/float(n))));
+              if (cost < bestCost) {
+                bestCost = cost;
+                numParts[i] = n;
+              }
+            }
+          }
+        });
+
+        /* calculate primref offsets and copy split primrefs to their new location */
+        size_t numSplitPrims = 0;
+        for (size_t i=0; i<numPrims; i++) {
+          const unsigned int n = numParts[i];
+          numParts[i] = (unsigned int) numSplitPrims;
+          numSplitPrims += n;
+        }
+        numParts[numPrims] = (unsigned int) numSplitPrims;
+        if (numSplitPrims == numPrims)
+          return pinfo;
+
+        mvector<PrimRef> prims0(scene->device,numPrims);
+        for (size_t i=0; i<numPrims; i++) prims0[i] = prims[i];
+        prims.resize(numSplitPrims);
+
+        const CentGeomBBox3fa bounds = parallel_reduce(size_t(0), numPrims, size_t(1024), CentGeomBBox3fa(empty), [&] (const range<size_t>& r) -> CentGeomBBox3fa
+        {
+          CentGeomBBox3fa bounds(empty);
+          for (size_t i=r.begin(); i<r.end(); i++)
+          {
+            const PrimRef& prim = prims0[i];
+            const unsigned int n = numParts[i+1]-numParts[i];
+            if (n == 1) {
+              prims[numParts[i]] = prim;
+              bounds.extend_center2(prim);
+              continue;
+            }
+
+            const Geometry* geom = scene->get(prim.geomID());
+            for (unsigned int k=0; k<n; k++)
+            {
+              const BBox1f u(float(k+0)/float(n),float(k+1)/float(n));
+              const BBox3fa box = intersect(prim.bounds(),geom->vbounds(LinearSpace3fa(one),prim.primID(),u));
+              const PrimRef part(box,prim.geomID(),prim.primID());
+              prims[numParts[i]+k] = part;
+              bounds.extend_center2(part);
+            }
+          }
+          return bounds;
+        }, CentGeomBBox3fa::merge2);
+
+        settings.splitPrims = true;
+        return PrimInfo(0,numSplitPrims,bounds);
+      }
+
       void clear() {
         prims.clear();
       }
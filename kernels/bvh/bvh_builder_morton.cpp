@@ -51,6 +51,7 @@ namespace embree
           node->setRef(i,children[i].ref);
           node->setBounds(i,b);
         }
+        node->setOctantOrder();
 
         BBox3fx result = (BBox3fx&)res;
 #if ROTATE_TREE
@@ -3,6 +3,7 @@
 
 #include "bvh.h"
 #include "bvh_builder.h"
+#include "bvh_refit.h"
 #include "../builders/bvh_builder_msmblur.h"
 
 #include "../builders/primrefgen.h"
@@ -89,15 +90,60 @@ namespace embree
       BVH* bvh;
     };
 
+    /* leaves that only store primitive IDs can get refitted by recalculating their linear bounds */
+    template<typename Primitive>
+    struct RefitMSMBlurLeaf
+    {
+      static const bool supported = false;
+
+      static __forceinline LBBox3fa linearBounds(Primitive* prims, size_t num, const Scene* scene, const BBox1f& time_range) {
+        return empty;
+      }
+    };
+
+    template<typename Primitive>
+    struct RefitMSMBlurLeafIndexed
+    {
+      static const bool supported = true;
+
+      static __forceinline LBBox3fa linearBounds(Primitive* prims, size_t num, const Scene* scene, const BBox1f& time_range)
+      {
+        LBBox3fa bounds = empty;
+        for (size_t i=0; i<num; i++)
+          bounds.extend(prims[i].linearBounds(scene,time_range));
+        return bounds;
+      }
+    };
+
+    template<> struct RefitMSMBlurLeaf<Triangle4i> : public RefitMSMBlurLeafIndexed<Triangle4i> {};
+    template<> struct RefitMSMBlurLeaf<Quad4i>     : public RefitMSMBlurLeafIndexed<Quad4i> {};
+
     /* Motion blur BVH with 4D nodes and internal time splits */
     template<int N, typename Mesh, typename Primitive>
-    struct BVHNBuilderMBlurSAH : public Builder
+    struct BVHNBuilderMBlurSAH : public Builder, public BVHNRefitterMB<N>::LeafBoundsInterface
     {
       typedef BVHN<N> BVH;
       typedef typename BVHN<N>::NodeRef NodeRef;
       typedef typename BVHN<N>::NodeRecordMB NodeRecordMB;
       typedef typename BVHN<N>::AABBNodeMB AABBNodeMB;
 
+      /* state of a geometry at the last build, the BVH can only get refitted if it did not change */
+      struct GeometryState
+      {
+        GeometryState (Geometry* geom, unsigned int topologyVersion)
+          : geom(geom), topologyVersion(topologyVersion), numTimeSteps(geom->numTimeSteps), time_range(geom->time_range) {}
+
+        __forceinline bool operator== (const GeometryState& other) const {
+          return geom == other.geom && topologyVersion == other.topologyVersion && numTimeSteps == other.numTimeSteps &&
+            time_range.lower == other.time_range.lower && time_range.upper == other.time_range.upper;
+        }
+
+        Geometry* geom;
+        unsigned int topologyVersion;
+        unsigned int numTimeSteps;
+        BBox1f time_range;
+      };
+
       BVH* bvh;
       Scene* scene;
       const size_t sahBlockSize;
@@ -105,15 +151,53 @@ namespace embree
       const size_t minLeafSize;
       const size_t maxLeafSize;
       const Geometry::GTypeMask gtype_;
+      std::unique_ptr<BVHNRefitterMB<N>> refitter;
+      std::vector<GeometryState> geometries;
 
       BVHNBuilderMBlurSAH (BVH* bvh, Scene* scene, const size_t sahBlockSize, const float intCost, const size_t minLeafSize, const size_t maxLeafSize, const Geometry::GTypeMask gtype)
-        : bvh(bvh), scene(scene), sahBlockSize(sahBlockSize), intCost(intCost), minLeafSize(minLeafSize), maxLeafSize(min(maxLeafSize,Primitive::max_size()*BVH::maxLeafBlocks)), gtype_(gtype) {}
+        : bvh(bvh), scene(scene), sahBlockSize(sahBlockSize), intCost(intCost), minLeafSize(minLeafSize), maxLeafSize(min(maxLeafSize,Primitive::max_size()*BVH::maxLeafBlocks)), gtype_(gtype),
+          refitter(RefitMSMBlurLeaf<Primitive>::supported ? new BVHNRefitterMB<N>(bvh,*this) : nullptr) {}
+
+      virtual const LBBox3fa leafBounds (NodeRef& ref, const BBox1f& time_range) const
+      {
+        size_t num; char* prim = ref.leaf(num);
+        if (unlikely(ref == BVH::emptyNode)) return empty;
+        return RefitMSMBlurLeaf<Primitive>::linearBounds((Primitive*)prim,num,scene,time_range);
+      }
+
+      /* returns the state of all geometries of the BVH, or an empty list if some geometry requires a rebuild */
+      std::vector<GeometryState> getGeometryStates()
+      {
+        std::vector<GeometryState> states;
+        if (!refitter) return states;
+
+        Scene::Iterator2 iter(scene,gtype_,true);
+        for (size_t i=0; i<iter.size(); i++)
+        {
+          Mesh* mesh = (Mesh*) iter[i];
+          if (mesh == nullptr) continue;
+          if (mesh->quality != RTC_BUILD_QUALITY_REFIT) return std::vector<GeometryState>();
+          states.push_back(GeometryState(mesh,mesh->getTopologyVersion()));
+        }
+        return states;
+      }
 
       void build()
       {
 	/* skip build for empty scene */
         const size_t numPrimitives = scene->getNumPrimitives(gtype_,true);
-        if (numPrimitives == 0) { bvh->clear(); return; }
+        if (numPrimitives == 0) { bvh->clear(); geometries.clear(); return; }
+
+        /* only refit the linear bounds if just the vertices of the geometries changed */
+        std::vector<GeometryState> states = getGeometryStates();
+        if (states.size() && states == geometries && bvh->root != BVH::emptyNode)
+        {
+          double t0 = bvh->preBuild(TOSTRING(isa) "::BVH" + toString(N) + "RefitMBlurSAH");
+          refitter->refit();
+          bvh->postBuild(t0);
+          return;
+        }
+        geometries = states;
 
         double t0 = bvh->preBuild(TOSTRING(isa) "::BVH" + toString(N) + "BuilderMBlurSAH");
 
@@ -186,6 +186,143 @@ namespace embree
     // =======================================================================================================
     // =======================================================================================================
 
+    template<int N>
+    struct BVHNSubdivPatch1LazyBuilderSAH : public Builder
+    {
+      ALIGNED_STRUCT_(64);
+
+      typedef BVHN<N> BVH;
+      typedef typename BVH::NodeRef NodeRef;
+
+      BVH* bvh;
+      Scene* scene;
+      mvector<PrimRef> prims;
+
+      BVHNSubdivPatch1LazyBuilderSAH (BVH* bvh, Scene* scene)
+        : bvh(bvh), scene(scene), prims(scene->device,0) {}
+
+      /* the limit surface of a face lies inside the convex hull of its
+       * 1-ring, as subdivision only forms convex combinations of vertices */
+      static BBox3fa faceBounds(const SubdivMesh* mesh, size_t f)
+      {
+        GeneralCatmullClarkPatch3fa patch(mesh->getHalfEdge(0,f),mesh->getVertexBuffer(0));
+        const BBox3fa bounds = patch.bounds();
+        const float eps = 4.0f*float(ulp)*reduce_max(max(abs(bounds.lower),abs(bounds.upper)));
+        return enlarge(bounds,Vec3fa(eps));
+      }
+
+      /* displaced patches get tessellated into a temporary grid to calculate exact bounds,
+       * unless the user provided a bound of the displacement */
+      static BBox3fa displacedBounds(const SubdivPatch1& patch, Scene* scene, std::vector<char>& temp)
+      {
+        auto alloc = [&] (const size_t bytes) { temp.resize(bytes); return temp.data(); };
+        BBox3fa bounds = empty;
+        GridSOA::create(&patch,1,scene,alloc,&bounds);
+        return bounds;
+      }
+
+      void build()
+      {
+        /* skip build for empty scene */
+        const size_t numPrimitives = scene->getNumPrimitives(SubdivMesh::geom_type,false);
+        if (numPrimitives == 0) {
+          prims.resize(numPrimitives);
+          bvh->set(BVH::emptyNode,empty,0);
+          return;
+        }
+
+        double t0 = bvh->preBuild(TOSTRING(isa) "::BVH" + toString(N) + "SubdivPatch1LazyBuilderSAH");
+
+        auto progress = [&] (size_t dn) { bvh->scene->progressMonitor(double(dn)); };
+        auto virtualprogress = BuildProgressMonitorFromClosure(progress);
+
+        ParallelForForPrefixSumState<PrimInfo> pstate;
+
+        /* calculate number of sub patches */
+        Scene::Iterator<SubdivMesh> iter(scene);
+        pstate.init(iter,size_t(1024));
+
+        PrimInfo pinfo1 = parallel_for_for_prefix_sum0( pstate, iter, PrimInfo(empty), [&](SubdivMesh* mesh, const range<size_t>& r, size_t k, size_t /*geomID*/) -> PrimInfo
+        {
+          size_t s = 0;
+          for (size_t f=r.begin(); f!=r.end(); ++f) {
+            if (!mesh->valid(f)) continue;
+            s += patch_eval_subdivision_count(mesh->getHalfEdge(0,f));
+          }
+          return PrimInfo(s,s,empty);
+        }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo(a.begin+b.begin,a.end+b.end,empty); });
+        const size_t numSubPatches = pinfo1.begin;
+        if (numSubPatches == 0) {
+          bvh->set(BVH::emptyNode,empty,0);
+          bvh->postBuild(t0);
+          return;
+        }
+
+        /* the patches get tessellated into the tessellation cache during rendering */
+        prims.resize(numSubPatches);
+        bvh->alloc.init_estimate(numSubPatches*sizeof(PrimRef));
+        bvh->subdiv_patches.resize(sizeof(SubdivPatch1) * numSubPatches);
+        SubdivPatch1* const subdiv_patches = (SubdivPatch1*) bvh->subdiv_patches.data();
+
+        PrimInfo pinfo3 = parallel_for_for_prefix_sum1( pstate, iter, PrimInfo(empty), [&](SubdivMesh* mesh, const range<size_t>& r, size_t k, size_t geomID, const PrimInfo& base) -> PrimInfo
+        {
+          std::vector<char> temp;
+          PrimInfo s(empty);
+          for (size_t f=r.begin(); f!=r.end(); ++f) {
+            if (!mesh->valid(f)) continue;
+
+            const BBox3fa bounds = faceBounds(mesh,f);
+            patch_eval_subdivision(mesh->getHalfEdge(0,f),[&](const Vec2f uv[4], const int subdiv[4], const float edge_level[4], int subPatch)
+            {
+              const size_t patchIndex = base.end+s.end;
+              assert(patchIndex < numSubPatches);
+              SubdivPatch1& patch = subdiv_patches[patchIndex];
+              new (&patch) SubdivPatch1(unsigned(geomID),unsigned(f),subPatch,mesh,0,uv,edge_level,subdiv,VSIZEX);
+              const BBox3fa patchBounds = !mesh->displFunc ? bounds : mesh->maxDisplacement > 0.0f ? enlarge(bounds,Vec3fa(mesh->maxDisplacement)) : displacedBounds(patch,scene,temp);
+              prims[patchIndex] = PrimRef(patchBounds,patchIndex);
+              s.add_center2(prims[patchIndex]);
+            });
+          }
+          return s;
+        }, [](const PrimInfo& a, const PrimInfo& b) -> PrimInfo { return PrimInfo::merge(a, b); });
+
+        PrimInfo pinfo(0,pinfo3.end,pinfo3);
+
+        auto createLeaf = [&] (const PrimRef* prims, const range<size_t>& range, Allocator alloc) -> NodeRef {
+          assert(range.size() == 1);
+          return bvh->encodeLeaf((char*)&subdiv_patches[prims[range.begin()].ID()],1);
+        };
+
+        /* settings for BVH build */
+        GeneralBVHBuilder::Settings settings;
+        settings.logBlockSize = bsr(N);
+        settings.minLeafSize = 1;
+        settings.maxLeafSize = 1;
+        settings.travCost = 1.0f;
+        settings.intCost = 1.0f;
+        settings.singleThreadThreshold = DEFAULT_SINGLE_THREAD_THRESHOLD;
+
+        NodeRef root = BVHNBuilderVirtual<N>::build(&bvh->alloc,createLeaf,virtualprogress,prims.data(),pinfo,settings);
+        bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
+        bvh->layoutLargeNodes(size_t(pinfo.size()*0.005f));
+
+	/* clear temporary data for static geometry */
+	if (scene->isStaticAccel()) {
+          prims.clear();
+        }
+        bvh->cleanup();
+        bvh->postBuild(t0);
+      }
+
+      void clear() {
+        prims.clear();
+      }
+    };
+
+    // =======================================================================================================
+    // =======================================================================================================
+    // =======================================================================================================
+
     struct SubdivRecalculatePrimRef
     {
       mvector<BBox3fa>& bounds;
@@ -386,6 +523,7 @@ namespace embree
     
     /* entry functions for the scene builder */
     Builder* BVH4SubdivPatch1BuilderSAH(void* bvh, Scene* scene, size_t mode) { return new BVHNSubdivPatch1BuilderSAH<4>((BVH4*)bvh,scene); }
+    Builder* BVH4SubdivPatch1LazyBuilderSAH(void* bvh, Scene* scene, size_t mode) { return new BVHNSubdivPatch1LazyBuilderSAH<4>((BVH4*)bvh,scene); }
     Builder* BVH4SubdivPatch1MBBuilderSAH(void* bvh, Scene* scene, size_t mode) { return new BVHNSubdivPatch1MBlurBuilderSAH<4>((BVH4*)bvh,scene); }
   }
 }
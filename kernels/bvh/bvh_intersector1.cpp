@@ -66,6 +66,9 @@ namespace embree
 
       /* initialize the node traverser */
       BVHNNodeTraverser1Hit<N, types> nodeTraverser;
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+      const size_t octant = BVHNNodeTraverser1HitOrdered<N, types>::octant(tray);
+#endif
 
       /* pop loop */
       while (true) pop:
@@ -93,6 +96,13 @@ namespace embree
             goto pop;
 
           /* select next child and push other children */
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+          /* static BVHs only contain AABB nodes which store the per octant child order */
+          if (types == BVH_AN1) {
+            BVHNNodeTraverser1HitOrdered<N, types>::traverseClosestHit(cur, mask, tNear, octant, stackPtr, stackEnd);
+            continue;
+          }
+#endif
           nodeTraverser.traverseClosestHit(cur, mask, tNear, stackPtr, stackEnd);
         }
 
@@ -298,15 +308,15 @@ namespace embree
 
     /* disable point queries for not yet supported geometry types */
     template<int N, int types, bool robust>
-    struct PointQueryDispatch<N, types, robust, VirtualCurveIntersector1> {
+    struct PointQueryDispatch<N, types, robust, SubdivPatch1Intersector1> {
       static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context) { return false; }
     };
     
     template<int N, int types, bool robust>
-    struct PointQueryDispatch<N, types, robust, SubdivPatch1Intersector1> {
+    struct PointQueryDispatch<N, types, robust, SubdivPatch1CachedIntersector1> {
       static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context) { return false; }
     };
-    
+
     template<int N, int types, bool robust>
     struct PointQueryDispatch<N, types, robust, SubdivPatch1MBIntersector1> {
       static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context) { return false; }
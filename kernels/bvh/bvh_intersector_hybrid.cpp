@@ -914,5 +914,336 @@ namespace embree
 
       vfloat<K>::store(valid & terminated, &ray.tfar, neg_inf);
     }
+
+    // ===================================================================================================================================================================
+    // ===================================================================================================================================================================
+    // ===================================================================================================================================================================
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersectorK, bool single>
+    void BVHNIntersectorKHybrid<N, K, types, robust, PrimitiveIntersectorK, single>::intersectTile(vint<K>* __restrict__ valid_i,
+                                                                                                   Accel::Intersectors* __restrict__ This,
+                                                                                                   RayHitK<K>* __restrict__ rays,
+                                                                                                   size_t numPackets,
+                                                                                                   RayQueryContext* context)
+    {
+      BVH* __restrict__ bvh = (BVH*)This->ptr;
+
+      /* we may traverse an empty BVH in case all geometry was invalid */
+      if (bvh->root == BVH::emptyNode)
+        return;
+
+      /* frustum culling is only supported for static AABB nodes, all other BVHs trace the tile packet by packet */
+      if (types != BVH_AN1)
+      {
+        for (size_t i=0; i<numPackets; i++)
+          intersect(&valid_i[i], This, rays[i], context);
+        return;
+      }
+
+      /* large tiles are split into chunks to bound the stack size */
+      for (size_t i=0; i<numPackets; i+=maxTilePackets)
+        intersectTileChunk(&valid_i[i], This, bvh, &rays[i], min(numPackets-i, size_t(maxTilePackets)), context);
+    }
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersectorK, bool single>
+    void BVHNIntersectorKHybrid<N, K, types, robust, PrimitiveIntersectorK, single>::intersectTileChunk(vint<K>* __restrict__ valid_i,
+                                                                                                        Accel::Intersectors* __restrict__ This,
+                                                                                                        const BVH* __restrict__ bvh,
+                                                                                                        RayHitK<K>* __restrict__ rays,
+                                                                                                        size_t numPackets,
+                                                                                                        RayQueryContext* context)
+    {
+      assert(numPackets <= maxTilePackets);
+
+      /* filter out invalid rays */
+      vbool<K> valid[maxTilePackets];
+      vint<K> octant[maxTilePackets];
+      size_t valid_packets = 0;
+      for (size_t i=0; i<numPackets; i++)
+      {
+        valid[i] = valid_i[i] == -1;
+#if defined(EMBREE_IGNORE_INVALID_RAYS)
+        valid[i] &= rays[i].valid();
+#endif
+        /* verify correct input */
+        assert(all(valid[i], rays[i].valid()));
+        assert(all(valid[i], rays[i].tnear() >= 0.0f));
+
+        octant[i] = select(valid[i], rays[i].octant(), vint<K>(0xffffffff));
+        if (any(valid[i])) valid_packets |= size_t(1) << i;
+      }
+
+      /* return if there are no valid rays */
+      if (unlikely(valid_packets == 0)) return;
+      const size_t active_packets = valid_packets;
+
+      /* precalculations are not default constructible, thus we construct them in place */
+      typename std::aligned_storage<sizeof(Precalculations), alignof(Precalculations)>::type pre_storage[maxTilePackets];
+      Precalculations* pre = (Precalculations*) pre_storage;
+
+      /* load rays */
+      TravRayK<K, robust> tray[maxTilePackets];
+      for (size_t bits = active_packets; bits != 0; )
+      {
+        const size_t i = bscf(bits);
+        new (&pre[i]) Precalculations(valid[i], rays[i]);
+        tray[i].init(rays[i].org, rays[i].dir, 0);
+      }
+
+      do
+      {
+        /* all rays with the same octant as the first remaining ray form a tile */
+        const size_t first = bsf(valid_packets);
+        const int cur_octant = octant[first][bsf(movemask(octant[first] != vint<K>(0xffffffff)))];
+
+        FrustumIntervals intervals;
+        size_t tile_packets = 0;
+        for (size_t bits = valid_packets; bits != 0; )
+        {
+          const size_t i = bscf(bits);
+          const vbool<K> octant_valid = octant[i] == vint<K>(cur_octant);
+          octant[i] = select(octant_valid, vint<K>(0xffffffff), octant[i]);
+          if (all(octant[i] == vint<K>(0xffffffff)))
+            valid_packets &= ~(size_t(1) << i);
+
+          if (none(octant_valid)) continue;
+          tile_packets |= size_t(1) << i;
+
+          tray[i].tnear = select(octant_valid, max(rays[i].tnear(), 0.0f), vfloat<K>(pos_inf));
+          tray[i].tfar  = select(octant_valid, max(rays[i].tfar   , 0.0f), vfloat<K>(neg_inf));
+          intervals.extend<K>(octant_valid, tray[i].org, tray[i].rdir, tray[i].tnear, tray[i].tfar);
+        }
+
+        Frustum<robust> frustum;
+        frustum.init(intervals, N);
+
+        StackItemT<NodeRef> stack[stackSizeSingle];  // stack of nodes
+        StackItemT<NodeRef>* stackPtr = stack + 1;   // current stack pointer
+        StackItemT<NodeRef>* stackEnd = stack + stackSizeSingle;
+        stack[0].ptr  = bvh->root;
+        stack[0].dist = neg_inf;
+
+        while (1) pop:
+        {
+          /* pop next node from stack */
+          if (unlikely(stackPtr == stack)) break;
+
+          stackPtr--;
+          NodeRef cur = NodeRef(stackPtr->ptr);
+
+          /* cull node if behind the closest hit point of all rays */
+          if (unlikely(*(float*)&stackPtr->dist > frustum.max_dist))
+            continue;
+
+          /* the inner nodes are only tested against the frustum of the tile */
+          while (likely(!cur.isLeaf()))
+          {
+            STAT3(normal.trav_nodes, 1, 1, 1);
+            vfloat<N> fmin;
+            const size_t m_frustum_node = intersectNodeFrustum<N>(cur.getAABBNode(), frustum, fmin);
+            if (unlikely(!m_frustum_node)) goto pop;
+
+            /* select next child and push other children */
+            BVHNNodeTraverser1Hit<N, types>::traverseClosestHit(cur, m_frustum_node, fmin, stackPtr, stackEnd);
+          }
+
+          /* intersect leaf with the active rays of all packets */
+          assert(cur != BVH::emptyNode);
+          STAT3(normal.trav_leaves, 1, 1, 1);
+          size_t items; const Primitive* prim = (Primitive*)cur.leaf(items);
+
+          size_t lazy_node = 0;
+          vfloat<K> tile_tfar = neg_inf;
+          for (size_t bits = tile_packets; bits != 0; )
+          {
+            const size_t i = bscf(bits);
+            const vbool<K> valid_leaf = tray[i].tnear <= tray[i].tfar;
+            if (likely(any(valid_leaf)))
+            {
+              PrimitiveIntersectorK::intersect(valid_leaf, This, pre[i], rays[i], context, prim, items, tray[i], lazy_node);
+              tray[i].tfar = select(valid_leaf, rays[i].tfar, tray[i].tfar);
+            }
+            tile_tfar = max(tile_tfar, tray[i].tfar);
+          }
+
+          /* reduce max distance of the frustum on successful intersection */
+          frustum.template updateMaxDist<K>(tile_tfar);
+
+          if (unlikely(lazy_node)) {
+            stackPtr->ptr = lazy_node;
+            stackPtr->dist = neg_inf;
+            stackPtr++;
+          }
+        }
+      } while (valid_packets);
+
+      for (size_t bits = active_packets; bits != 0; )
+        pre[bscf(bits)].~Precalculations();
+    }
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersectorK, bool single>
+    void BVHNIntersectorKHybrid<N, K, types, robust, PrimitiveIntersectorK, single>::occludedTile(vint<K>* __restrict__ valid_i,
+                                                                                                  Accel::Intersectors* __restrict__ This,
+                                                                                                  RayK<K>* __restrict__ rays,
+                                                                                                  size_t numPackets,
+                                                                                                  RayQueryContext* context)
+    {
+      BVH* __restrict__ bvh = (BVH*)This->ptr;
+
+      /* we may traverse an empty BVH in case all geometry was invalid */
+      if (bvh->root == BVH::emptyNode)
+        return;
+
+      /* frustum culling is only supported for static AABB nodes, all other BVHs trace the tile packet by packet */
+      if (types != BVH_AN1)
+      {
+        for (size_t i=0; i<numPackets; i++)
+          occluded(&valid_i[i], This, rays[i], context);
+        return;
+      }
+
+      /* large tiles are split into chunks to bound the stack size */
+      for (size_t i=0; i<numPackets; i+=maxTilePackets)
+        occludedTileChunk(&valid_i[i], This, bvh, &rays[i], min(numPackets-i, size_t(maxTilePackets)), context);
+    }
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersectorK, bool single>
+    void BVHNIntersectorKHybrid<N, K, types, robust, PrimitiveIntersectorK, single>::occludedTileChunk(vint<K>* __restrict__ valid_i,
+                                                                                                       Accel::Intersectors* __restrict__ This,
+                                                                                                       const BVH* __restrict__ bvh,
+                                                                                                       RayK<K>* __restrict__ rays,
+                                                                                                       size_t numPackets,
+                                                                                                       RayQueryContext* context)
+    {
+      assert(numPackets <= maxTilePackets);
+
+      /* filter out already occluded and invalid rays */
+      vbool<K> valid[maxTilePackets];
+      vbool<K> terminated[maxTilePackets];
+      vint<K> octant[maxTilePackets];
+      size_t valid_packets = 0;
+      for (size_t i=0; i<numPackets; i++)
+      {
+        valid[i] = (valid_i[i] == -1) & (rays[i].tfar >= 0.0f);
+#if defined(EMBREE_IGNORE_INVALID_RAYS)
+        valid[i] &= rays[i].valid();
+#endif
+        /* verify correct input */
+        assert(all(valid[i], rays[i].valid()));
+        assert(all(valid[i], rays[i].tnear() >= 0.0f));
+
+        terminated[i] = !valid[i];
+        octant[i] = select(valid[i], rays[i].octant(), vint<K>(0xffffffff));
+        if (any(valid[i])) valid_packets |= size_t(1) << i;
+      }
+
+      /* return if there are no valid rays */
+      if (unlikely(valid_packets == 0)) return;
+      const size_t active_packets = valid_packets;
+
+      /* precalculations are not default constructible, thus we construct them in place */
+      typename std::aligned_storage<sizeof(Precalculations), alignof(Precalculations)>::type pre_storage[maxTilePackets];
+      Precalculations* pre = (Precalculations*) pre_storage;
+
+      /* load rays */
+      TravRayK<K, robust> tray[maxTilePackets];
+      for (size_t bits = active_packets; bits != 0; )
+      {
+        const size_t i = bscf(bits);
+        new (&pre[i]) Precalculations(valid[i], rays[i]);
+        tray[i].init(rays[i].org, rays[i].dir, 0);
+      }
+
+      do
+      {
+        /* all rays with the same octant as the first remaining ray form a tile */
+        const size_t first = bsf(valid_packets);
+        const int cur_octant = octant[first][bsf(movemask(octant[first] != vint<K>(0xffffffff)))];
+
+        FrustumIntervals intervals;
+        size_t tile_packets = 0;
+        for (size_t bits = valid_packets; bits != 0; )
+        {
+          const size_t i = bscf(bits);
+          const vbool<K> octant_valid = octant[i] == vint<K>(cur_octant);
+          octant[i] = select(octant_valid, vint<K>(0xffffffff), octant[i]);
+          if (all(octant[i] == vint<K>(0xffffffff)))
+            valid_packets &= ~(size_t(1) << i);
+
+          if (none(octant_valid)) continue;
+          tile_packets |= size_t(1) << i;
+
+          tray[i].tnear = select(octant_valid, max(rays[i].tnear(), 0.0f), vfloat<K>(pos_inf));
+          tray[i].tfar  = select(octant_valid, max(rays[i].tfar   , 0.0f), vfloat<K>(neg_inf));
+          intervals.extend<K>(octant_valid, tray[i].org, tray[i].rdir, tray[i].tnear, tray[i].tfar);
+        }
+
+        Frustum<robust> frustum;
+        frustum.init(intervals, N);
+
+        NodeRef stack[stackSizeSingle];  // stack of nodes that still need to get traversed
+        NodeRef* stackPtr = stack + 1;   // current stack pointer
+        NodeRef* stackEnd = stack + stackSizeSingle;
+        stack[0] = bvh->root;
+
+        while (1) pop:
+        {
+          /* pop next node from stack */
+          if (unlikely(stackPtr == stack)) break;
+
+          stackPtr--;
+          NodeRef cur = (NodeRef)*stackPtr;
+
+          /* the inner nodes are only tested against the frustum of the tile */
+          while (likely(!cur.isLeaf()))
+          {
+            STAT3(shadow.trav_nodes, 1, 1, 1);
+            vfloat<N> fmin;
+            const size_t m_frustum_node = intersectNodeFrustum<N>(cur.getAABBNode(), frustum, fmin);
+            if (unlikely(!m_frustum_node)) goto pop;
+
+            /* select next child and push other children */
+            BVHNNodeTraverser1Hit<N, types>::traverseAnyHit(cur, m_frustum_node, fmin, stackPtr, stackEnd);
+          }
+
+          /* intersect leaf with the active rays of all packets */
+          assert(cur != BVH::emptyNode);
+          STAT3(shadow.trav_leaves, 1, 1, 1);
+          size_t items; const Primitive* prim = (Primitive*)cur.leaf(items);
+
+          size_t lazy_node = 0;
+          for (size_t bits = tile_packets; bits != 0; )
+          {
+            const size_t i = bscf(bits);
+            const vbool<K> valid_leaf = tray[i].tnear <= tray[i].tfar;
+            if (unlikely(none(valid_leaf))) {
+              tile_packets &= ~(size_t(1) << i);
+              continue;
+            }
+
+            /* the primitive intersector reports inactive rays as occluded, thus mask them out */
+            terminated[i] |= valid_leaf & PrimitiveIntersectorK::occluded(valid_leaf, This, pre[i], rays[i], context, prim, items, tray[i], lazy_node);
+            tray[i].tfar = select(terminated[i], vfloat<K>(neg_inf), tray[i].tfar); // ignore node intersections for terminated rays
+
+            /* remove packet from tile once all its rays are occluded */
+            if (none(tray[i].tnear <= tray[i].tfar))
+              tile_packets &= ~(size_t(1) << i);
+          }
+          if (unlikely(tile_packets == 0)) break;
+
+          if (unlikely(lazy_node)) {
+            *stackPtr = lazy_node;
+            stackPtr++;
+          }
+        }
+      } while (valid_packets);
+
+      for (size_t bits = active_packets; bits != 0; )
+      {
+        const size_t i = bscf(bits);
+        vfloat<K>::store(valid[i] & terminated[i], &rays[i].tfar, neg_inf);
+        pre[i].~Precalculations();
+      }
+    }
   }
 }
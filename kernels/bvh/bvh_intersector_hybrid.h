@@ -36,12 +36,17 @@ namespace embree
       (K==16) ? 14 : // 14 seems to work best for KNL due to better ordered chunk traversal
       0;
 
+      static const size_t maxTilePackets = 256/K; // tiles of up to 16x16 rays are traced at once
+
     private:
       static void intersect1(Accel::Intersectors* This, const BVH* bvh, NodeRef root, size_t k, Precalculations& pre,
                              RayHitK<K>& ray, const TravRayK<K, robust>& tray, RayQueryContext* context);
       static bool occluded1(Accel::Intersectors* This, const BVH* bvh, NodeRef root, size_t k, Precalculations& pre,
                             RayK<K>& ray, const TravRayK<K, robust>& tray, RayQueryContext* context);
 
+      static void intersectTileChunk(vint<K>* valid, Accel::Intersectors* This, const BVH* bvh, RayHitK<K>* rays, size_t numPackets, RayQueryContext* context);
+      static void occludedTileChunk (vint<K>* valid, Accel::Intersectors* This, const BVH* bvh, RayK<K>* rays, size_t numPackets, RayQueryContext* context);
+
     public:
       static void intersect(vint<K>* valid, Accel::Intersectors* This, RayHitK<K>& ray, RayQueryContext* context);
       static void occluded (vint<K>* valid, Accel::Intersectors* This, RayK<K>& ray, RayQueryContext* context);
@@ -49,6 +54,9 @@ namespace embree
       static void intersectCoherent(vint<K>* valid, Accel::Intersectors* This, RayHitK<K>& ray, RayQueryContext* context);
       static void occludedCoherent (vint<K>* valid, Accel::Intersectors* This, RayK<K>& ray, RayQueryContext* context);
 
+      static void intersectTile(vint<K>* valid, Accel::Intersectors* This, RayHitK<K>* rays, size_t numPackets, RayQueryContext* context);
+      static void occludedTile (vint<K>* valid, Accel::Intersectors* This, RayK<K>* rays, size_t numPackets, RayQueryContext* context);
+
     };
 
     /*! BVH packet intersector. */
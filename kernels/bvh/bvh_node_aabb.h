@@ -56,6 +56,7 @@ namespace embree
 #endif
         AABBNode_t* node = ref.getAABBNode();
         for (size_t i=0; i<num; i++) node->setRef(i,children[i]);
+        node->setOctantOrder();
         return ref;
       }
     };
@@ -78,6 +79,7 @@ namespace embree
 #endif
         AABBNode_t* node = ref.getAABBNode();
         for (size_t i=0; i<num; i++) node->setRef(i,children[i]);
+        node->setOctantOrder();
         
         if (unlikely(precord.alloc_barrier))
         {
@@ -98,8 +100,40 @@ namespace embree
     __forceinline void clear() {
       lower_x = lower_y = lower_z = pos_inf;
       upper_x = upper_y = upper_z = neg_inf;
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+      for (size_t octant=0; octant<8; octant++)
+        order[octant] = (N == 4) ? 0x3210 : 0x76543210;
+#endif
       BaseNode_t<NodeRef,N>::clear();
     }
+
+    /*! Sorts the children front to back for each ray direction octant,
+     *  using the box corner that is entered first by rays of that octant. */
+    __forceinline void setOctantOrder()
+    {
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+      for (size_t octant=0; octant<8; octant++)
+      {
+        const vfloat<N> dx = (octant & 1) ? -upper_x : lower_x;
+        const vfloat<N> dy = (octant & 2) ? -upper_y : lower_y;
+        const vfloat<N> dz = (octant & 4) ? -upper_z : lower_z;
+        const vfloat<N> dist = dx+dy+dz; // empty children get +inf and end up last
+
+        unsigned int slots[N];
+        for (size_t i=0; i<N; i++)
+        {
+          size_t j = i;
+          for (; j>0 && dist[slots[j-1]] > dist[i]; j--)
+            slots[j] = slots[j-1];
+          slots[j] = (unsigned int) i;
+        }
+
+        order[octant] = 0;
+        for (size_t i=0; i<N; i++)
+          order[octant] |= slots[i] << (4*i);
+      }
+#endif
+    }
     
     /*! Sets bounding box and ID of child. */
     __forceinline void setRef(size_t i, const NodeRef& ref) {
@@ -145,6 +179,14 @@ namespace embree
     /*! Returns bounds of all children (implemented later as specializations) */
     __forceinline void bounds(BBox<vfloat4>& bounds0, BBox<vfloat4>& bounds1, BBox<vfloat4>& bounds2, BBox<vfloat4>& bounds3) const;
     
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+    /*! Returns the child slot that is k-th closest for rays of the given octant. */
+    __forceinline size_t orderedChild(size_t octant, size_t k) const {
+      assert(octant < 8 && k < N);
+      return (order[octant] >> (4*k)) & 0xF;
+    }
+#endif
+
     /*! swap two children of the node */
     __forceinline void swap(size_t i, size_t j)
     {
@@ -219,6 +261,9 @@ namespace embree
     vfloat<N> upper_y;           //!< Y dimension of upper bounds of all N children.
     vfloat<N> lower_z;           //!< Z dimension of lower bounds of all N children.
     vfloat<N> upper_z;           //!< Z dimension of upper bounds of all N children.
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+    unsigned int order[8];       //!< Front to back child order for each ray direction octant, 4 bits per child.
+#endif
   };
 
   template<>
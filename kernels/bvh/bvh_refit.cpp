@@ -119,6 +119,7 @@ namespace embree
         node->upper_x = boundsT.upper.x;
         node->upper_y = boundsT.upper.y;
         node->upper_z = boundsT.upper.z;
+        node->setOctantOrder();
         
         return merge<N>(bounds);
       }
@@ -165,10 +166,71 @@ namespace embree
       node->upper_x = boundsT.upper.x;
       node->upper_y = boundsT.upper.y;
       node->upper_z = boundsT.upper.z;
+      node->setOctantOrder();
 
       return merge<N>(bounds);
     }
 
+    // =========================================================
+    // =========================================================
+    // =========================================================
+
+    template<int N>
+    BVHNRefitterMB<N>::BVHNRefitterMB (BVH* bvh, const LeafBoundsInterface& leafBounds)
+      : bvh(bvh), leafBounds(leafBounds)
+    {
+    }
+
+    template<int N>
+    void BVHNRefitterMB<N>::refit()
+    {
+      /* the builder creates the root for the time range [0,1] */
+      const size_t depth = bvh->numPrimitives <= SINGLE_THREAD_THRESHOLD ? MAX_PARALLEL_DEPTH : 0;
+      bvh->bounds = recurse(bvh->root,BBox1f(0.0f,1.0f),depth);
+    }
+
+    template<int N>
+    LBBox3fa BVHNRefitterMB<N>::recurse(NodeRef& ref, const BBox1f& time_range, const size_t depth)
+    {
+      /* this is a leaf node */
+      if (unlikely(ref.isLeaf()))
+        return leafBounds.leafBounds(ref,time_range);
+
+      /* children of 4D nodes only cover parts of the time range of the node */
+      AABBNodeMB* node = ref.getAABBNodeMB();
+      BBox1f dt[N];
+      for (size_t i=0; i<N; i++) dt[i] = time_range;
+      if (ref.isAABBNodeMB4D())
+      {
+        AABBNodeMB4D* node4D = ref.getAABBNodeMB4D();
+        for (size_t i=0; i<N; i++)
+          dt[i] = BBox1f(node4D->lower_t[i],min(node4D->upper_t[i],1.0f));
+      }
+
+      LBBox3fa bounds[N];
+      auto refitChild = [&] (size_t i) {
+        if (unlikely(node->child(i) == BVH::emptyNode)) return;
+        bounds[i] = recurse(node->child(i),dt[i],depth+1);
+      };
+
+      if (depth < MAX_PARALLEL_DEPTH)
+        parallel_for(size_t(N), refitChild);
+      else
+        for (size_t i=0; i<N; i++)
+          refitChild(i);
+
+      /* set new bounds, the node stores them relative to the [0,1] time range */
+      LBBox3fa allBounds = empty;
+      for (size_t i=0; i<N; i++)
+      {
+        if (unlikely(node->child(i) == BVH::emptyNode)) continue;
+        if (ref.isAABBNodeMB4D()) ref.getAABBNodeMB4D()->set(i,NodeRecordMB4D(node->child(i),bounds[i],dt[i]));
+        else                      node->set(i,NodeRecordMB4D(node->child(i),bounds[i],dt[i]));
+        allBounds.extend(LBBox3fa(dt[i],bounds[i],time_range));
+      }
+      return allBounds;
+    }
+
     template<int N, typename Mesh, typename Primitive>
     BVHNRefitT<N,Mesh,Primitive>::BVHNRefitT (BVH* bvh, Builder* builder, Mesh* mesh, size_t mode)
       : bvh(bvh), builder(builder), refitter(new BVHNRefitter<N>(bvh,*(typename BVHNRefitter<N>::LeafBoundsInterface*)this)), mesh(mesh), topologyVersion(0) {}
@@ -192,8 +254,10 @@ namespace embree
     }
 
     template class BVHNRefitter<4>;
+    template class BVHNRefitterMB<4>;
 #if defined(__AVX__)
     template class BVHNRefitter<8>;
+    template class BVHNRefitterMB<8>;
 #endif
     
 #if defined(EMBREE_GEOMETRY_TRIANGLE)
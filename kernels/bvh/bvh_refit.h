@@ -56,6 +56,41 @@ namespace embree
       NodeRef subTrees[MAX_NUM_SUB_TREES];
     };
 
+    template<int N>
+    class BVHNRefitterMB
+    {
+    public:
+
+      /*! Type shortcuts */
+      typedef BVHN<N> BVH;
+      typedef typename BVH::AABBNodeMB AABBNodeMB;
+      typedef typename BVH::AABBNodeMB4D AABBNodeMB4D;
+      typedef typename BVH::NodeRef NodeRef;
+      typedef typename BVH::NodeRecordMB4D NodeRecordMB4D;
+
+      struct LeafBoundsInterface {
+        virtual const LBBox3fa leafBounds(NodeRef& ref, const BBox1f& time_range) const = 0;
+      };
+
+    public:
+
+      /*! Constructor. */
+      BVHNRefitterMB (BVH* bvh, const LeafBoundsInterface& leafBounds);
+
+      /*! refits the linear bounds of all time segments of the BVH */
+      void refit();
+
+    private:
+      /* refits the subtree for the time range it got built for, the top levels are processed in parallel */
+      LBBox3fa recurse(NodeRef& ref, const BBox1f& time_range, const size_t depth);
+
+    public:
+      BVH* bvh;                              //!< BVH to refit
+      const LeafBoundsInterface& leafBounds; //!< calculates linear bounds of leaves
+
+      static const size_t MAX_PARALLEL_DEPTH = (N==4) ? 4 : 3;
+    };
+
     template<int N, typename Mesh, typename Primitive>
     class BVHNRefitT : public Builder, public BVHNRefitter<N>::LeafBoundsInterface
     {
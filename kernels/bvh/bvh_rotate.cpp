@@ -117,6 +117,8 @@ namespace embree
       parent->setBounds(bestChild2,child2->bounds());
       AABBNode::compact(parent);
       AABBNode::compact(child2);
+      parent->setOctantOrder();
+      child2->setOctantOrder();
       
       /*! This returned depth is conservative as the child that was
        *  pulled up in the tree could have been on the critical path. */
@@ -462,5 +462,64 @@ namespace embree
         }
       }
     };
+
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+
+    /*! BVH regular node traversal for single rays using the child order
+     *  precomputed per ray octant, which avoids sorting hit children. */
+    template<int N, int types>
+    class BVHNNodeTraverser1HitOrdered
+    {
+      typedef BVHN<N> BVH;
+      typedef typename BVH::NodeRef NodeRef;
+      typedef typename BVH::AABBNode AABBNode;
+
+    public:
+      template<bool robust>
+      static __forceinline size_t octant(const TravRay<N,robust>& ray)
+      {
+        return ((ray.nearX & sizeof(vfloat<N>)) ? 1 : 0) |
+               ((ray.nearY & sizeof(vfloat<N>)) ? 2 : 0) |
+               ((ray.nearZ & sizeof(vfloat<N>)) ? 4 : 0);
+      }
+
+      /* Traverses a node with at least one hit child. Optimized for finding the closest hit (intersection). */
+      static __forceinline void traverseClosestHit(NodeRef& cur,
+                                                   size_t mask,
+                                                   const vfloat<N>& tNear,
+                                                   size_t octant,
+                                                   StackItemT<NodeRef>*& stackPtr,
+                                                   StackItemT<NodeRef>* stackEnd)
+      {
+        assert(mask != 0);
+        const AABBNode* node = cur.getAABBNode();
+
+        /*! one child is hit, continue with that child */
+        if (likely((mask & (mask-1)) == 0)) {
+          cur = node->child(bsf(mask));
+          BVH::prefetch(cur,types);
+          assert(cur != BVH::emptyNode);
+          return;
+        }
+
+        /*! push all children from far to near but only advance the
+         *  stack pointer for hit children, the nearest hit child ends up
+         *  on top of the stack and is continued with */
+        for (ssize_t k=N-1; k>=0; k--)
+        {
+          const size_t i = node->orderedChild(octant,k);
+          assert(stackPtr < stackEnd);
+          stackPtr->ptr  = node->child(i);
+          stackPtr->dist = ((unsigned int*)&tNear)[i];
+          stackPtr += (mask >> i) & 1;
+        }
+        stackPtr--;
+        cur = NodeRef(stackPtr->ptr);
+        BVH::prefetch(cur,types);
+        assert(cur != BVH::emptyNode);
+      }
+    };
+
+#endif
   }
 }
@@ -28,6 +28,45 @@ namespace embree
          t_max = (p_min - org_max) / dir_max = (p_min - org_max)*rdir_min = p_min*rdir_min - org_max*rdir_min
     */
 
+    /* Conservative intervals of the origins, reciprocal directions
+       and distances of a set of ray packets. These are used to build
+       a single frustum for a tile of ray packets. */
+    struct FrustumIntervals
+    {
+      __forceinline FrustumIntervals()
+        : min_org(pos_inf), max_org(neg_inf), min_rdir(pos_inf), max_rdir(neg_inf), min_dist(pos_inf), max_dist(neg_inf) {}
+
+      template<int K>
+      __forceinline void extend(const vbool<K>& valid, const Vec3vf<K>& org, const Vec3vf<K>& rdir, const vfloat<K>& ray_tnear, const vfloat<K>& ray_tfar)
+      {
+        min_org = min(min_org, Vec3fa(reduce_min(select(valid, org.x, pos_inf)),
+                                      reduce_min(select(valid, org.y, pos_inf)),
+                                      reduce_min(select(valid, org.z, pos_inf))));
+
+        max_org = max(max_org, Vec3fa(reduce_max(select(valid, org.x, neg_inf)),
+                                      reduce_max(select(valid, org.y, neg_inf)),
+                                      reduce_max(select(valid, org.z, neg_inf))));
+
+        min_rdir = min(min_rdir, Vec3fa(reduce_min(select(valid, rdir.x, pos_inf)),
+                                        reduce_min(select(valid, rdir.y, pos_inf)),
+                                        reduce_min(select(valid, rdir.z, pos_inf))));
+
+        max_rdir = max(max_rdir, Vec3fa(reduce_max(select(valid, rdir.x, neg_inf)),
+                                        reduce_max(select(valid, rdir.y, neg_inf)),
+                                        reduce_max(select(valid, rdir.z, neg_inf))));
+
+        min_dist = min(min_dist, reduce_min(select(valid, ray_tnear, vfloat<K>(pos_inf))));
+        max_dist = max(max_dist, reduce_max(select(valid, ray_tfar , vfloat<K>(neg_inf))));
+      }
+
+      Vec3fa min_org;
+      Vec3fa max_org;
+      Vec3fa min_rdir;
+      Vec3fa max_rdir;
+      float min_dist;
+      float max_dist;
+    };
+
     template<bool robust>
     struct Frustum;
     
@@ -88,6 +127,11 @@ namespace embree
         nf = NearFarPrecalculations(min_rdir, N);
       }
 
+      __forceinline void init(const FrustumIntervals& intervals, int N)
+      {
+        init(intervals.min_org, intervals.max_org, intervals.min_rdir, intervals.max_rdir, intervals.min_dist, intervals.max_dist, N);
+      }
+
       template<int K>
       __forceinline void updateMaxDist(const vfloat<K>& ray_tfar)
       {
@@ -164,6 +208,11 @@ namespace embree
         nf = NearFarPrecalculations(min_rdir, N);
       }
 
+      __forceinline void init(const FrustumIntervals& intervals, int N)
+      {
+        init(intervals.min_org, intervals.max_org, intervals.min_rdir, intervals.max_rdir, intervals.min_dist, intervals.max_dist, N);
+      }
+
       template<int K>
       __forceinline void updateMaxDist(const vfloat<K>& ray_tfar)
       {
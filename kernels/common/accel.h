@@ -116,6 +116,48 @@ namespace embree
                                     RTCRay16& ray,      /*!< ray packet to test occlusion. */
                                     RayQueryContext* context);
 
+    /*! Type of intersect function pointer for tiles of ray packets of size 4. */
+    typedef void (*IntersectTileFunc4)(const void* valid,  /*!< pointer to valid masks of all packets */
+                                       Intersectors* This, /*!< this pointer to accel */
+                                       RTCRayHit4* rays,   /*!< ray packets of the tile to intersect */
+                                       size_t numPackets,  /*!< number of ray packets in the tile */
+                                       RayQueryContext* context);
+
+    /*! Type of intersect function pointer for tiles of ray packets of size 8. */
+    typedef void (*IntersectTileFunc8)(const void* valid,  /*!< pointer to valid masks of all packets */
+                                       Intersectors* This, /*!< this pointer to accel */
+                                       RTCRayHit8* rays,   /*!< ray packets of the tile to intersect */
+                                       size_t numPackets,  /*!< number of ray packets in the tile */
+                                       RayQueryContext* context);
+
+    /*! Type of intersect function pointer for tiles of ray packets of size 16. */
+    typedef void (*IntersectTileFunc16)(const void* valid,  /*!< pointer to valid masks of all packets */
+                                        Intersectors* This, /*!< this pointer to accel */
+                                        RTCRayHit16* rays,  /*!< ray packets of the tile to intersect */
+                                        size_t numPackets,  /*!< number of ray packets in the tile */
+                                        RayQueryContext* context);
+
+    /*! Type of occlusion function pointer for tiles of ray packets of size 4. */
+    typedef void (*OccludedTileFunc4) (const void* valid,  /*!< pointer to valid masks of all packets */
+                                       Intersectors* This, /*!< this pointer to accel */
+                                       RTCRay4* rays,      /*!< ray packets of the tile to test occlusion */
+                                       size_t numPackets,  /*!< number of ray packets in the tile */
+                                       RayQueryContext* context);
+
+    /*! Type of occlusion function pointer for tiles of ray packets of size 8. */
+    typedef void (*OccludedTileFunc8) (const void* valid,  /*!< pointer to valid masks of all packets */
+                                       Intersectors* This, /*!< this pointer to accel */
+                                       RTCRay8* rays,      /*!< ray packets of the tile to test occlusion */
+                                       size_t numPackets,  /*!< number of ray packets in the tile */
+                                       RayQueryContext* context);
+
+    /*! Type of occlusion function pointer for tiles of ray packets of size 16. */
+    typedef void (*OccludedTileFunc16) (const void* valid,  /*!< pointer to valid masks of all packets */
+                                        Intersectors* This, /*!< this pointer to accel */
+                                        RTCRay16* rays,     /*!< ray packets of the tile to test occlusion */
+                                        size_t numPackets,  /*!< number of ray packets in the tile */
+                                        RayQueryContext* context);
+
     typedef void (*ErrorFunc) ();
 
     struct Collider
@@ -157,10 +199,13 @@ namespace embree
     struct Intersector4 
     {
       Intersector4 (ErrorFunc error = nullptr)
-      : intersect((IntersectFunc4)error), occluded((OccludedFunc4)error), name(nullptr) {}
+      : intersect((IntersectFunc4)error), occluded((OccludedFunc4)error), intersectTile((IntersectTileFunc4)error), occludedTile((OccludedTileFunc4)error), name(nullptr) {}
 
       Intersector4 (IntersectFunc4 intersect, OccludedFunc4 occluded, const char* name)
-      : intersect(intersect), occluded(occluded), name(name) {}
+      : intersect(intersect), occluded(occluded), intersectTile(nullptr), occludedTile(nullptr), name(name) {}
+
+      Intersector4 (IntersectFunc4 intersect, OccludedFunc4 occluded, IntersectTileFunc4 intersectTile, OccludedTileFunc4 occludedTile, const char* name)
+      : intersect(intersect), occluded(occluded), intersectTile(intersectTile), occludedTile(occludedTile), name(name) {}
 
       operator bool() const { return name; }
       
@@ -168,16 +213,21 @@ namespace embree
       static const char* type;
       IntersectFunc4 intersect;
       OccludedFunc4 occluded;
+      IntersectTileFunc4 intersectTile;
+      OccludedTileFunc4 occludedTile;
       const char* name;
     };
     
     struct Intersector8 
     {
       Intersector8 (ErrorFunc error = nullptr)
-      : intersect((IntersectFunc8)error), occluded((OccludedFunc8)error), name(nullptr) {}
+      : intersect((IntersectFunc8)error), occluded((OccludedFunc8)error), intersectTile((IntersectTileFunc8)error), occludedTile((OccludedTileFunc8)error), name(nullptr) {}
 
       Intersector8 (IntersectFunc8 intersect, OccludedFunc8 occluded, const char* name)
-      : intersect(intersect), occluded(occluded), name(name) {}
+      : intersect(intersect), occluded(occluded), intersectTile(nullptr), occludedTile(nullptr), name(name) {}
+
+      Intersector8 (IntersectFunc8 intersect, OccludedFunc8 occluded, IntersectTileFunc8 intersectTile, OccludedTileFunc8 occludedTile, const char* name)
+      : intersect(intersect), occluded(occluded), intersectTile(intersectTile), occludedTile(occludedTile), name(name) {}
 
       operator bool() const { return name; }
       
@@ -185,16 +235,21 @@ namespace embree
       static const char* type;
       IntersectFunc8 intersect;
       OccludedFunc8 occluded;
+      IntersectTileFunc8 intersectTile;
+      OccludedTileFunc8 occludedTile;
       const char* name;
     };
     
     struct Intersector16 
     {
       Intersector16 (ErrorFunc error = nullptr)
-      : intersect((IntersectFunc16)error), occluded((OccludedFunc16)error), name(nullptr) {}
+      : intersect((IntersectFunc16)error), occluded((OccludedFunc16)error), intersectTile((IntersectTileFunc16)error), occludedTile((OccludedTileFunc16)error), name(nullptr) {}
 
       Intersector16 (IntersectFunc16 intersect, OccludedFunc16 occluded, const char* name)
-      : intersect(intersect), occluded(occluded), name(name) {}
+      : intersect(intersect), occluded(occluded), intersectTile(nullptr), occludedTile(nullptr), name(name) {}
+
+      Intersector16 (IntersectFunc16 intersect, OccludedFunc16 occluded, IntersectTileFunc16 intersectTile, OccludedTileFunc16 occludedTile, const char* name)
+      : intersect(intersect), occluded(occluded), intersectTile(intersectTile), occludedTile(occludedTile), name(name) {}
 
       operator bool() const { return name; }
       
@@ -202,6 +257,8 @@ namespace embree
       static const char* type;
       IntersectFunc16 intersect;
       OccludedFunc16 occluded;
+      IntersectTileFunc16 intersectTile;
+      OccludedTileFunc16 occludedTile;
       const char* name;
     };
 
@@ -288,6 +345,42 @@ namespace embree
         intersector16.intersect(valid,this,ray,context);
       }
 
+      /*! Intersects a tile of ray packets of size 4 with the scene. */
+      __forceinline void intersectTile4 (const void* valid, RTCRayHit4* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector4.intersectTile)) {
+          intersector4.intersectTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector4.intersect);
+        for (size_t i=0; i<numPackets; i++)
+          intersector4.intersect((const int*)valid+4*i,this,rays[i],context);
+      }
+
+      /*! Intersects a tile of ray packets of size 8 with the scene. */
+      __forceinline void intersectTile8 (const void* valid, RTCRayHit8* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector8.intersectTile)) {
+          intersector8.intersectTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector8.intersect);
+        for (size_t i=0; i<numPackets; i++)
+          intersector8.intersect((const int*)valid+8*i,this,rays[i],context);
+      }
+
+      /*! Intersects a tile of ray packets of size 16 with the scene. */
+      __forceinline void intersectTile16 (const void* valid, RTCRayHit16* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector16.intersectTile)) {
+          intersector16.intersectTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector16.intersect);
+        for (size_t i=0; i<numPackets; i++)
+          intersector16.intersect((const int*)valid+16*i,this,rays[i],context);
+      }
+
       /*! Intersects a packet of 4 rays with the scene. */
       __forceinline void intersect (const void* valid, RTCRayHit4& ray, RayQueryContext* context) {
         assert(intersector4.intersect);
@@ -349,6 +442,42 @@ namespace embree
         intersector16.occluded(valid,this,ray,context);
       }
 
+      /*! Tests if a tile of ray packets of size 4 is occluded by the scene. */
+      __forceinline void occludedTile4 (const void* valid, RTCRay4* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector4.occludedTile)) {
+          intersector4.occludedTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector4.occluded);
+        for (size_t i=0; i<numPackets; i++)
+          intersector4.occluded((const int*)valid+4*i,this,rays[i],context);
+      }
+
+      /*! Tests if a tile of ray packets of size 8 is occluded by the scene. */
+      __forceinline void occludedTile8 (const void* valid, RTCRay8* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector8.occludedTile)) {
+          intersector8.occludedTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector8.occluded);
+        for (size_t i=0; i<numPackets; i++)
+          intersector8.occluded((const int*)valid+8*i,this,rays[i],context);
+      }
+
+      /*! Tests if a tile of ray packets of size 16 is occluded by the scene. */
+      __forceinline void occludedTile16 (const void* valid, RTCRay16* rays, size_t numPackets, RayQueryContext* context)
+      {
+        if (likely(intersector16.occludedTile)) {
+          intersector16.occludedTile(valid,this,rays,numPackets,context);
+          return;
+        }
+        assert(intersector16.occluded);
+        for (size_t i=0; i<numPackets; i++)
+          intersector16.occluded((const int*)valid+16*i,this,rays[i],context);
+      }
+
       /*! Tests if a packet of 4 rays is occluded by the scene. */
       __forceinline void occluded (const void* valid, RTCRay4& ray, RayQueryContext* context) {
         assert(intersector4.occluded);
@@ -453,22 +582,28 @@ namespace embree
   
 #define DEFINE_INTERSECTOR4(symbol,intersector)                               \
   Accel::Intersector4 symbol() {                                              \
-    return Accel::Intersector4((Accel::IntersectFunc4)intersector::intersect, \
-                               (Accel::OccludedFunc4)intersector::occluded,   \
-                               TOSTRING(isa) "::" TOSTRING(symbol));          \
+    return Accel::Intersector4((Accel::IntersectFunc4)intersector::intersect,         \
+                               (Accel::OccludedFunc4)intersector::occluded,           \
+                               (Accel::IntersectTileFunc4)intersector::intersectTile, \
+                               (Accel::OccludedTileFunc4)intersector::occludedTile,   \
+                               TOSTRING(isa) "::" TOSTRING(symbol));                  \
   }
   
 #define DEFINE_INTERSECTOR8(symbol,intersector)                               \
   Accel::Intersector8 symbol() {                                              \
-    return Accel::Intersector8((Accel::IntersectFunc8)intersector::intersect, \
-                               (Accel::OccludedFunc8)intersector::occluded,   \
-                               TOSTRING(isa) "::" TOSTRING(symbol));          \
+    return Accel::Intersector8((Accel::IntersectFunc8)intersector::intersect,         \
+                               (Accel::OccludedFunc8)intersector::occluded,           \
+                               (Accel::IntersectTileFunc8)intersector::intersectTile, \
+                               (Accel::OccludedTileFunc8)intersector::occludedTile,   \
+                               TOSTRING(isa) "::" TOSTRING(symbol));                  \
   }
 
 #define DEFINE_INTERSECTOR16(symbol,intersector)                                \
   Accel::Intersector16 symbol() {                                               \
-    return Accel::Intersector16((Accel::IntersectFunc16)intersector::intersect, \
-                                (Accel::OccludedFunc16)intersector::occluded,   \
-                                TOSTRING(isa) "::" TOSTRING(symbol));           \
+    return Accel::Intersector16((Accel::IntersectFunc16)intersector::intersect,         \
+                                (Accel::OccludedFunc16)intersector::occluded,           \
+                                (Accel::IntersectTileFunc16)intersector::intersectTile, \
+                                (Accel::OccludedTileFunc16)intersector::occludedTile,   \
+                                TOSTRING(isa) "::" TOSTRING(symbol));                   \
   }
 }
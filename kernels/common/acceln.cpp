@@ -133,6 +133,54 @@ namespace embree
     }
   }
 
+  void AccelN::intersectTile4 (const void* valid, Accel::Intersectors* This_in, RTCRayHit4* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.intersectTile4(valid,rays,numPackets,context);
+  }
+
+  void AccelN::intersectTile8 (const void* valid, Accel::Intersectors* This_in, RTCRayHit8* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.intersectTile8(valid,rays,numPackets,context);
+  }
+
+  void AccelN::intersectTile16 (const void* valid, Accel::Intersectors* This_in, RTCRayHit16* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.intersectTile16(valid,rays,numPackets,context);
+  }
+
+  void AccelN::occludedTile4 (const void* valid, Accel::Intersectors* This_in, RTCRay4* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.occludedTile4(valid,rays,numPackets,context);
+  }
+
+  void AccelN::occludedTile8 (const void* valid, Accel::Intersectors* This_in, RTCRay8* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.occludedTile8(valid,rays,numPackets,context);
+  }
+
+  void AccelN::occludedTile16 (const void* valid, Accel::Intersectors* This_in, RTCRay16* rays, size_t numPackets, RayQueryContext* context) 
+  {
+    AccelN* This = (AccelN*)This_in->ptr;
+    for (size_t i=0; i<This->accels.size(); i++)
+      if (!This->accels[i]->isEmpty())
+        This->accels[i]->intersectors.occludedTile16(valid,rays,numPackets,context);
+  }
+
   void AccelN::accels_print(size_t ident)
   {
     for (size_t i=0; i<accels.size(); i++)
@@ -181,9 +229,9 @@ namespace embree
       type = AccelData::TY_ACCELN;
       intersectors.ptr = this;
       intersectors.intersector1  = Intersector1(&intersect,&occluded,&pointQuery,valid1 ? "AccelN::intersector1": nullptr);
-      intersectors.intersector4  = Intersector4(&intersect4,&occluded4,valid4 ? "AccelN::intersector4" : nullptr);
-      intersectors.intersector8  = Intersector8(&intersect8,&occluded8,valid8 ? "AccelN::intersector8" : nullptr);
-      intersectors.intersector16 = Intersector16(&intersect16,&occluded16,valid16 ? "AccelN::intersector16": nullptr);
+      intersectors.intersector4  = Intersector4(&intersect4,&occluded4,&intersectTile4,&occludedTile4,valid4 ? "AccelN::intersector4" : nullptr);
+      intersectors.intersector8  = Intersector8(&intersect8,&occluded8,&intersectTile8,&occludedTile8,valid8 ? "AccelN::intersector8" : nullptr);
+      intersectors.intersector16 = Intersector16(&intersect16,&occluded16,&intersectTile16,&occludedTile16,valid16 ? "AccelN::intersector16": nullptr);
 
       /*! calculate bounds */
       bounds = empty;
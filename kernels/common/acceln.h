@@ -33,6 +33,16 @@ namespace embree
     static void occluded8 (const void* valid, Accel::Intersectors* This, RTCRay8& ray, RayQueryContext* context);
     static void occluded16 (const void* valid, Accel::Intersectors* This, RTCRay16& ray, RayQueryContext* context);
 
+  public:
+    static void intersectTile4 (const void* valid, Accel::Intersectors* This, RTCRayHit4* rays, size_t numPackets, RayQueryContext* context);
+    static void intersectTile8 (const void* valid, Accel::Intersectors* This, RTCRayHit8* rays, size_t numPackets, RayQueryContext* context);
+    static void intersectTile16 (const void* valid, Accel::Intersectors* This, RTCRayHit16* rays, size_t numPackets, RayQueryContext* context);
+
+  public:
+    static void occludedTile4 (const void* valid, Accel::Intersectors* This, RTCRay4* rays, size_t numPackets, RayQueryContext* context);
+    static void occludedTile8 (const void* valid, Accel::Intersectors* This, RTCRay8* rays, size_t numPackets, RayQueryContext* context);
+    static void occludedTile16 (const void* valid, Accel::Intersectors* This, RTCRay16* rays, size_t numPackets, RayQueryContext* context);
+
   public:
     void accels_print(size_t ident);
     void accels_immutable();
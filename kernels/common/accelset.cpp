@@ -10,8 +10,8 @@ namespace embree
     : Geometry(device,gtype,(unsigned int)numItems,(unsigned int)numTimeSteps), boundsFunc(nullptr) {}
 
   AccelSet::IntersectorN::IntersectorN (ErrorFunc error) 
-    : intersect((IntersectFuncN)error), occluded((OccludedFuncN)error), name(nullptr) {}
+    : intersect((IntersectFuncN)error), occluded((OccludedFuncN)error), intersectBatch(nullptr), occludedBatch(nullptr), name(nullptr) {}
   
   AccelSet::IntersectorN::IntersectorN (IntersectFuncN intersect, OccludedFuncN occluded, const char* name)
-    : intersect(intersect), occluded(occluded), name(name) {}
+    : intersect(intersect), occluded(occluded), intersectBatch(nullptr), occludedBatch(nullptr), name(name) {}
 }
@@ -34,6 +34,8 @@ namespace embree
   public:
     typedef RTCIntersectFunctionN IntersectFuncN;  
     typedef RTCOccludedFunctionN OccludedFuncN;
+    typedef RTCIntersectFunctionBatch IntersectFuncBatch;
+    typedef RTCOccludedFunctionBatch OccludedFuncBatch;
     typedef void (*ErrorFunc) ();
 
       struct IntersectorN
@@ -47,6 +49,8 @@ namespace embree
         static const char* type;
         IntersectFuncN intersect;
         OccludedFuncN occluded; 
+        IntersectFuncBatch intersectBatch;
+        OccludedFuncBatch occludedBatch;
         const char* name;
       };
       
@@ -333,6 +337,82 @@ namespace embree
         occludedFunc(&args);
       }
 
+      /*! Returns true if the batched intersect callback is used for this query. */
+      __forceinline bool hasIntersectFunctionBatch(RayQueryContext* context) const {
+        return intersectorN.intersectBatch && !context->getIntersectFunction();
+      }
+
+      /*! Returns true if the batched occlusion callback is used for this query. */
+      __forceinline bool hasOccludedFunctionBatch(RayQueryContext* context) const {
+        return intersectorN.occludedBatch && !context->getOccludedFunction();
+      }
+
+      /*! Intersects a single ray with multiple primitives using the batched callback. */
+      __forceinline void intersectBatch (RayHit& ray, unsigned int geomID, const unsigned int* primIDs, unsigned int numPrims, RayQueryContext* context)
+      {
+        int mask = -1;
+        RTCIntersectFunctionBatchArguments args;
+        args.valid = &mask;
+        args.geometryUserPtr = userPtr;
+        args.primIDs = primIDs;
+        args.numPrims = numPrims;
+        args.context = context->user;
+        args.rayhit = (RTCRayHitN*)&ray;
+        args.N = 1;
+        args.geomID = geomID;
+        intersectorN.intersectBatch(&args);
+      }
+
+      /*! Tests if a single ray is occluded by multiple primitives using the batched callback. */
+      __forceinline void occludedBatch (Ray& ray, unsigned int geomID, const unsigned int* primIDs, unsigned int numPrims, RayQueryContext* context)
+      {
+        int mask = -1;
+        RTCOccludedFunctionBatchArguments args;
+        args.valid = &mask;
+        args.geometryUserPtr = userPtr;
+        args.primIDs = primIDs;
+        args.numPrims = numPrims;
+        args.context = context->user;
+        args.ray = (RTCRayN*)&ray;
+        args.N = 1;
+        args.geomID = geomID;
+        intersectorN.occludedBatch(&args);
+      }
+
+      /*! Intersects a packet of K rays with multiple primitives using the batched callback. */
+      template<int K>
+        __forceinline void intersectBatch (const vbool<K>& valid, RayHitK<K>& ray, unsigned int geomID, const unsigned int* primIDs, unsigned int numPrims, RayQueryContext* context)
+      {
+        vint<K> mask = valid.mask32();
+        RTCIntersectFunctionBatchArguments args;
+        args.valid = (int*)&mask;
+        args.geometryUserPtr = userPtr;
+        args.primIDs = primIDs;
+        args.numPrims = numPrims;
+        args.context = context->user;
+        args.rayhit = (RTCRayHitN*)&ray;
+        args.N = K;
+        args.geomID = geomID;
+        intersectorN.intersectBatch(&args);
+      }
+
+      /*! Tests if a packet of K rays is occluded by multiple primitives using the batched callback. */
+      template<int K>
+        __forceinline void occludedBatch (const vbool<K>& valid, RayK<K>& ray, unsigned int geomID, const unsigned int* primIDs, unsigned int numPrims, RayQueryContext* context)
+      {
+        vint<K> mask = valid.mask32();
+        RTCOccludedFunctionBatchArguments args;
+        args.valid = (int*)&mask;
+        args.geometryUserPtr = userPtr;
+        args.primIDs = primIDs;
+        args.numPrims = numPrims;
+        args.context = context->user;
+        args.ray = (RTCRayN*)&ray;
+        args.N = K;
+        args.geomID = geomID;
+        intersectorN.occludedBatch(&args);
+      }
+
     public:
       RTCBoundsFunction boundsFunc;
       IntersectorN intersectorN;
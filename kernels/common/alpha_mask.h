@@ -0,0 +1,94 @@
+// Copyright 2009-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "default.h"
+#include "device.h"
+#include "buffer.h"
+
+namespace embree
+{
+  /*! Alpha mask texture of a triangle or quad mesh. The mask gets
+   *  evaluated by the intersectors directly, without invoking a filter
+   *  callback. */
+  struct AlphaMask
+  {
+    AlphaMask (Device* device)
+      : format(RTC_ALPHA_MASK_FORMAT_UNDEFINED), width(0), height(0), uvSlot(0), cutoff(0.0f), texels(device) {}
+
+    /*! sets the texels of the mask, a NULL texel pointer disables the mask */
+    void set(RTCAlphaMaskFormat format_in, const void* texels_in, unsigned int width_in, unsigned int height_in, unsigned int uvSlot_in, float cutoff_in)
+    {
+      if (texels_in == nullptr) {
+        format = RTC_ALPHA_MASK_FORMAT_UNDEFINED;
+        texels.clear();
+        return;
+      }
+
+      size_t bytes = 0;
+      switch (format_in) {
+      case RTC_ALPHA_MASK_FORMAT_BIT  : bytes = (size_t(width_in)*size_t(height_in)+7)/8; break;
+      case RTC_ALPHA_MASK_FORMAT_UCHAR: bytes = size_t(width_in)*size_t(height_in); break;
+      default: throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"invalid alpha mask format");
+      }
+      if (width_in == 0 || height_in == 0)
+        throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"invalid alpha mask size");
+
+      format = format_in;
+      width = width_in;
+      height = height_in;
+      uvSlot = uvSlot_in;
+      cutoff = 255.0f*cutoff_in;
+      texels.resize(bytes);
+      memcpy(texels.data(),texels_in,bytes);
+    }
+
+    /*! verifies that the texture coordinates are stored in a valid vertex attribute buffer */
+    void verifyTexcoords(const Device::vector<RawBufferView>& vertexAttribs) const
+    {
+      if (!enabled()) return;
+      if (uvSlot >= vertexAttribs.size() || !vertexAttribs[uvSlot])
+        throw_RTCError(RTC_ERROR_INVALID_OPERATION,"alpha mask requires a vertex attribute buffer with texture coordinates");
+      const RTCFormat format = vertexAttribs[uvSlot].getFormat();
+      if (format < RTC_FORMAT_FLOAT2 || format > RTC_FORMAT_FLOAT16)
+        throw_RTCError(RTC_ERROR_INVALID_OPERATION,"alpha mask texture coordinates require a float vertex attribute format with at least two components");
+    }
+
+    /*! checks if the mask is enabled */
+    __forceinline bool enabled() const {
+      return format != RTC_ALPHA_MASK_FORMAT_UNDEFINED;
+    }
+
+    /*! tests if the texel at texture coordinate uv is opaque, using nearest sampling and wrapping */
+    __forceinline bool opaque(const Vec2f& uv) const
+    {
+      int x = int(floor(uv.x*float(width)))  % int(width);
+      int y = int(floor(uv.y*float(height))) % int(height);
+      if (x < 0) x += width;
+      if (y < 0) y += height;
+      const size_t i = size_t(y)*width+size_t(x);
+      if (format == RTC_ALPHA_MASK_FORMAT_BIT)
+        return (texels[i>>3] >> (i&7)) & 1;
+      else
+        return float(texels[i]) >= cutoff;
+    }
+
+    /*! tests the mask at barycentric coordinates u/v of the triangle spanned by vertices v0, v1, and v2 */
+    __forceinline bool opaque(const RawBufferView& uvs, unsigned int v0, unsigned int v1, unsigned int v2, float u, float v) const
+    {
+      const Vec2f uv0 = *(const Vec2f*)uvs.getPtr(v0);
+      const Vec2f uv1 = *(const Vec2f*)uvs.getPtr(v1);
+      const Vec2f uv2 = *(const Vec2f*)uvs.getPtr(v2);
+      return opaque((1.0f-u-v)*uv0 + u*uv1 + v*uv2);
+    }
+
+  public:
+    RTCAlphaMaskFormat format;           //!< texel format, undefined if mask is disabled
+    unsigned int width;                  //!< width of mask in texels
+    unsigned int height;                 //!< height of mask in texels
+    unsigned int uvSlot;                 //!< vertex attribute slot storing the texture coordinates
+    float cutoff;                        //!< 8 bit texels below this value are transparent
+    Device::vector<unsigned char> texels; //!< texel data
+  };
+}
@@ -417,6 +417,24 @@ namespace embree
     case 1000003: debug_int3 = val; return;
     }
 
+    switch (prop)
+    {
+#if defined(EMBREE_GEOMETRY_SUBDIVISION)
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE:
+      if (val < 0) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid tessellation cache size");
+      setCacheSize((size_t)val);
+      return;
+
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_HITS:
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES:
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_FLUSHES:
+      if (val != 0) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "tessellation cache statistics can only get reset to 0");
+      SharedLazyTessellationCache::sharedLazyTessellationCache.resetStats();
+      return;
+#endif
+    default: break;
+    }
+
     throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "unknown writable property");
   }
 
@@ -570,6 +588,18 @@ namespace embree
     case RTC_DEVICE_PROPERTY_PARALLEL_COMMIT_SUPPORTED: return 0;
 #endif
 
+#if defined(EMBREE_GEOMETRY_SUBDIVISION)
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE   : return (ssize_t) SharedLazyTessellationCache::sharedLazyTessellationCache.getSize();
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_HITS   : return (ssize_t) SharedLazyTessellationCache::sharedLazyTessellationCache.getStats().hits;
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES : return (ssize_t) SharedLazyTessellationCache::sharedLazyTessellationCache.getStats().misses;
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_FLUSHES: return (ssize_t) SharedLazyTessellationCache::sharedLazyTessellationCache.getStats().flushes;
+#else
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE   : return 0;
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_HITS   : return 0;
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES : return 0;
+    case RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_FLUSHES: return 0;
+#endif
+
     default: throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "unknown readable property"); break;
     };
   }
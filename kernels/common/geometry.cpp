@@ -3,6 +3,7 @@
 
 #include "geometry.h"
 #include "scene.h"
+#include "point_query_knn.h"
 
 namespace embree
 {
@@ -52,6 +53,7 @@ namespace embree
       state((unsigned)State::MODIFIED),
       enabled(true),
       argumentFilterEnabled(false),
+      alphaMaskEnabled(false),
       intersectionFilterN(nullptr), occlusionFilterN(nullptr), pointQueryFunc(nullptr)
   {
     device->refInc();
@@ -248,7 +250,8 @@ namespace embree
 
     bool update = false;
     if(context->func)  update |= context->func(&args);
-    if(pointQueryFunc) update |= pointQueryFunc(&args);
+    /* k nearest neighbor queries calculate distances internally, thus do not invoke geometry callbacks */
+    if(pointQueryFunc && context->func != PointQueryKNN::pointQueryFunc) update |= pointQueryFunc(&args);
 
     if (update && context->userContext->instStackSize > 0)
     {
@@ -189,7 +189,8 @@ namespace embree
     {
       GTY_SUBTYPE_DEFAULT= 0,
       GTY_SUBTYPE_INSTANCE_LINEAR = 0,
-      GTY_SUBTYPE_INSTANCE_QUATERNION = 1
+      GTY_SUBTYPE_INSTANCE_QUATERNION = 1,
+      GTY_SUBTYPE_INSTANCE_CUBIC = 2
     };
 
     enum GTypeMask
@@ -272,9 +273,14 @@ namespace embree
       return argumentFilterEnabled;
     }
     
-    /*! tests if that geometry has some filter function set */
+    /*! tests if that geometry has some filter function or alpha mask set */
     __forceinline bool hasGeometryFilterFunctions () const {
-      return (intersectionFilterN  != nullptr) || (occlusionFilterN  != nullptr);
+      return (intersectionFilterN  != nullptr) || (occlusionFilterN  != nullptr) || alphaMaskEnabled;
+    }
+
+    /*! tests if that geometry has a built-in alpha mask set */
+    __forceinline bool hasAlphaMask () const {
+      return alphaMaskEnabled;
     }
 
     /*! returns geometry type */
@@ -363,6 +369,11 @@ namespace embree
     virtual void updateBuffer(RTCBufferType type, unsigned int slot) {
       update(); // update everything for geometries not supporting this call
     }
+
+    /*! marks the items [first,first+count) of some buffer as modified */
+    virtual void updateBufferRange(RTCBufferType type, unsigned int slot, size_t first, size_t count) {
+      updateBuffer(type,slot); // update entire buffer for geometries not supporting this call
+    }
     
     /*! Disable geometry. */
     virtual void disable();
@@ -390,6 +401,11 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Sets the ray distance range in which the geometry is visible. */
+    virtual void setLODRange(float nearDistance, float farDistance) {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Set user data pointer. */
     virtual void setUserData(void* ptr);
       
@@ -424,6 +440,16 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! sets camera position and rate for adaptive tessellation */
+    virtual void setTessellationCamera(const Vec3fa& P, float rate) {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
+    /*! sets the bound of the displacement */
+    virtual void setMaxDisplacement(float maxDisplacement) {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     virtual unsigned int getFirstHalfEdge(unsigned int faceID) {
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
@@ -507,6 +533,11 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Sets how the transformations of the instance get interpolated between time steps */
+    virtual void setTransformInterpolation(RTCTransformInterpolation interpolation) {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Returns the transformation of the instance */
     virtual AffineSpace3fa getTransform(float time) {
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry");
@@ -525,6 +556,11 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Sets the built-in alpha mask. */
+    virtual void setAlphaMask (RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff) { 
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Set intersect function for ray packets of size N. */
     virtual void setIntersectFunctionN (RTCIntersectFunctionN intersect) { 
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
@@ -534,6 +570,16 @@ namespace embree
     virtual void setOccludedFunctionN (RTCOccludedFunctionN occluded) { 
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
+
+    /*! Set intersect function invoked for all primitives of a BVH leaf at once. */
+    virtual void setIntersectFunctionBatch (RTCIntersectFunctionBatch intersect) { 
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+    
+    /*! Set occlusion function invoked for all primitives of a BVH leaf at once. */
+    virtual void setOccludedFunctionBatch (RTCOccludedFunctionBatch occluded) { 
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
     
     /*! Set point query function. */
     void setPointQueryFunction(RTCPointQueryFunction func);
@@ -614,6 +660,10 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"vbounds not implemented for this geometry"); 
     }
 
+    virtual BBox3fa vbounds(const LinearSpace3fa& space, size_t primID, const BBox1f& u) const {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"vbounds not implemented for this geometry"); 
+    }
+
     virtual LBBox3fa vlinearBounds(size_t primID, const BBox1f& time_range) const {
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"vlinearBounds not implemented for this geometry"); 
     }
@@ -631,8 +681,8 @@ namespace embree
     }
     
   public:
-    __forceinline bool hasIntersectionFilter() const { return intersectionFilterN != nullptr; }
-    __forceinline bool hasOcclusionFilter() const { return occlusionFilterN != nullptr; }
+    __forceinline bool hasIntersectionFilter() const { return intersectionFilterN != nullptr || alphaMaskEnabled; }
+    __forceinline bool hasOcclusionFilter() const { return occlusionFilterN != nullptr || alphaMaskEnabled; }
 
   public:
     Device* device;             //!< device this geometry belongs to
@@ -654,6 +704,7 @@ namespace embree
       unsigned state : 2;
       bool enabled : 1;               //!< true if geometry is enabled
       bool argumentFilterEnabled : 1; //!< true if argument filter functions are enabled for this geometry
+      bool alphaMaskEnabled : 1;      //!< true if the built-in alpha mask is enabled for this geometry
     };
        
     RTCFilterFunctionN intersectionFilterN;
@@ -139,6 +139,69 @@ struct MotionDerivative
   }
 };
 
+struct CubicMotionDerivativeCoefficients
+{
+  AffineSpace3fa C[4];
+
+  CubicMotionDerivativeCoefficients() {}
+
+  // power basis of the Catmull-Rom segment between xfm1 and xfm2 (see cubic in affinespace.h)
+  CubicMotionDerivativeCoefficients(AffineSpace3fa const& xfm0, AffineSpace3fa const& xfm1,
+                                    AffineSpace3fa const& xfm2, AffineSpace3fa const& xfm3)
+  {
+    C[0] = xfm1;
+    C[1] = 0.5f*(xfm2-xfm0);
+    C[2] = xfm0 - 2.5f*xfm1 + 2.0f*xfm2 - 0.5f*xfm3;
+    C[3] = 0.5f*(xfm3-xfm0) + 1.5f*(xfm1-xfm2);
+  }
+};
+
+/* derivative of one dimension of the cubic transformation applied to the
+ * linearly blended point lerp(p0,p1,t), which is a cubic polynomial in t */
+struct CubicMotionDerivative
+{
+  float c[4];
+
+  CubicMotionDerivative(CubicMotionDerivativeCoefficients const& mdc,
+                        int dim, Vec3fa const& p0, Vec3fa const& p1)
+  {
+    float a[4], b[4];
+    for (int k = 0; k < 4; ++k) {
+      a[k] = xfmPoint (mdc.C[k], p0)[dim];
+      b[k] = xfmVector(mdc.C[k], p1-p0)[dim];
+    }
+    c[0] = a[1] + b[0];
+    c[1] = 2.f*(a[2] + b[1]);
+    c[2] = 3.f*(a[3] + b[2]);
+    c[3] = 4.f*b[3];
+  }
+
+  template<typename T>
+  struct EvalCubicMotionDerivative
+  {
+    CubicMotionDerivative const& md;
+    float offset;
+
+    EvalCubicMotionDerivative(CubicMotionDerivative const& md, float offset) : md(md), offset(offset) {}
+
+    T operator()(T const& time) const {
+      return md.c[0] + offset + time * (md.c[1] + time * (md.c[2] + time * md.c[3]));
+    }
+  };
+
+  unsigned int findRoots(
+    Interval1f const& interval,
+    float offset,
+    float* roots,
+    unsigned int maxNumRoots)
+  {
+    unsigned int numRoots = 0;
+    EvalCubicMotionDerivative<Interval1f> eval(*this, offset);
+    MotionDerivative::findRoots(eval, interval, numRoots, roots, maxNumRoots);
+    return numRoots;
+  }
+};
+
 /******************************************************************************
  *                       Code generated with sympy 1.4                        *
  *              See http://www.sympy.org/ for more information.               *
@@ -0,0 +1,197 @@
+// Copyright 2009-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "default.h"
+#include "scene.h"
+
+#include <algorithm>
+
+namespace embree
+{
+  /* k nearest neighbor point query, the neighbors found so far are
+   * kept in a bounded max heap ordered by distance, thus the query
+   * radius can get shrunk to the distance of the k'th neighbor as soon
+   * as k neighbors are found */
+  struct PointQueryKNN
+  {
+    __forceinline PointQueryKNN (Scene* scene, unsigned int k, RTCPointQueryNeighbor* neighbors)
+      : scene(scene), k(k), num(0), neighbors(neighbors) {}
+
+    static __forceinline bool compare(const RTCPointQueryNeighbor& a, const RTCPointQueryNeighbor& b) {
+      return a.distance < b.distance;
+    }
+
+    static __forceinline bool samePrimitive(const RTCPointQueryNeighbor& a, const RTCPointQueryNeighbor& b)
+    {
+      if (a.primID != b.primID || a.geomID != b.geomID) return false;
+      for (unsigned int l=0; l<RTC_MAX_INSTANCE_LEVEL_COUNT; l++) {
+        if (a.instID[l] != b.instID[l]) return false;
+#if defined(RTC_GEOMETRY_INSTANCE_ARRAY)
+        if (a.instPrimID[l] != b.instPrimID[l]) return false;
+#endif
+      }
+      return true;
+    }
+
+    /* inserts a neighbor into the heap, returns true if the query radius got shrunk */
+    __forceinline bool insert(const RTCPointQueryNeighbor& neighbor, float& radius)
+    {
+      /* spatial splits may reference a primitive from multiple leaves */
+      for (unsigned int i=0; i<num; i++)
+        if (samePrimitive(neighbors[i],neighbor)) return false;
+
+      if (num < k) {
+        neighbors[num++] = neighbor;
+        std::push_heap(neighbors,neighbors+num,compare);
+      }
+      else {
+        if (neighbor.distance >= neighbors[0].distance) return false;
+        std::pop_heap(neighbors,neighbors+num,compare);
+        neighbors[num-1] = neighbor;
+        std::push_heap(neighbors,neighbors+num,compare);
+      }
+
+      if (num < k || neighbors[0].distance >= radius)
+        return false;
+
+      radius = neighbors[0].distance;
+      return true;
+    }
+
+    /* sorts the neighbors by increasing distance */
+    __forceinline void finish() {
+      std::sort_heap(neighbors,neighbors+num,compare);
+    }
+
+    /* calculates the closest point to p on the triangle (a,b,c) */
+    static __forceinline Vec3fa closestPointTriangle(const Vec3fa& p, const Vec3fa& a, const Vec3fa& b, const Vec3fa& c)
+    {
+      const Vec3fa ab = b - a;
+      const Vec3fa ac = c - a;
+      const Vec3fa ap = p - a;
+
+      const float d1 = dot(ab, ap);
+      const float d2 = dot(ac, ap);
+      if (d1 <= 0.f && d2 <= 0.f) return a;
+
+      const Vec3fa bp = p - b;
+      const float d3 = dot(ab, bp);
+      const float d4 = dot(ac, bp);
+      if (d3 >= 0.f && d4 <= d3) return b;
+
+      const Vec3fa cp = p - c;
+      const float d5 = dot(ab, cp);
+      const float d6 = dot(ac, cp);
+      if (d6 >= 0.f && d5 <= d6) return c;
+
+      const float vc = d1 * d4 - d3 * d2;
+      if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+      {
+        const float v = d1 / (d1 - d3);
+        return a + v * ab;
+      }
+
+      const float vb = d5 * d2 - d1 * d6;
+      if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+      {
+        const float v = d2 / (d2 - d6);
+        return a + v * ac;
+      }
+
+      const float va = d3 * d6 - d5 * d4;
+      if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+      {
+        const float v = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return b + v * (c - b);
+      }
+
+      const float denom = 1.f / (va + vb + vc);
+      const float v = vb * denom;
+      const float w = vc * denom;
+      return a + v * ab + w * ac;
+    }
+
+    /* point query callback that calculates the distance to point and triangle primitives */
+    static bool pointQueryFunc(RTCPointQueryFunctionArguments* args)
+    {
+      PointQueryKNN* knn = (PointQueryKNN*) args->userPtr;
+      RTCPointQueryContext* context = args->context;
+      RTCPointQuery* query = args->query;
+
+      /* find the scene the primitive is contained in by following the instance stack */
+      Scene* scene = knn->scene;
+      for (unsigned int l=0; l<context->instStackSize; l++)
+      {
+        Geometry* instance = scene->get(context->instID[l]);
+#if defined(RTC_GEOMETRY_INSTANCE_ARRAY)
+        if (instance->getTypeMask() & Geometry::MTY_INSTANCE_ARRAY) {
+          scene = (Scene*) ((InstanceArray*)instance)->getObject(context->instPrimID[l]);
+          continue;
+        }
+#endif
+        scene = (Scene*) ((Instance*)instance)->object;
+      }
+
+      /* fetch the primitive in world space */
+      const Vec3fa q(query->x,query->y,query->z);
+      Geometry* geometry = scene->get(args->geomID);
+      AffineSpace3fa local2world = one;
+      if (context->instStackSize > 0)
+        local2world = AffineSpace3fa_load_unaligned((AffineSpace3fa*)context->inst2world[context->instStackSize-1]);
+
+      Vec3fa p;
+      if (geometry->getTypeMask() & Geometry::MTY_TRIANGLE_MESH)
+      {
+        const TriangleMesh* mesh = (const TriangleMesh*) geometry;
+        const TriangleMesh::Triangle& tri = mesh->triangle(args->primID);
+        Vec3fa v0, v1, v2;
+        if (mesh->hasMotionBlur()) {
+          v0 = mesh->vertex(tri.v[0],query->time);
+          v1 = mesh->vertex(tri.v[1],query->time);
+          v2 = mesh->vertex(tri.v[2],query->time);
+        } else {
+          v0 = mesh->vertex(tri.v[0]);
+          v1 = mesh->vertex(tri.v[1]);
+          v2 = mesh->vertex(tri.v[2]);
+        }
+        p = closestPointTriangle(q,xfmPoint(local2world,v0),xfmPoint(local2world,v1),xfmPoint(local2world,v2));
+      }
+      else if (geometry->getTypeMask() & Geometry::MTY_POINTS)
+      {
+        const Points* points = (const Points*) geometry;
+        p = xfmPoint(local2world,Vec3fa(points->vertex_safe(args->primID,query->time)));
+      }
+      else
+        return false;
+
+      /* skip primitives outside the query radius, as the traversal culls only conservatively */
+      const float distance = length(q-p);
+      if (distance > query->radius)
+        return false;
+
+      RTCPointQueryNeighbor neighbor;
+      neighbor.x = p.x;
+      neighbor.y = p.y;
+      neighbor.z = p.z;
+      neighbor.distance = distance;
+      neighbor.primID = args->primID;
+      neighbor.geomID = args->geomID;
+      for (unsigned int l=0; l<RTC_MAX_INSTANCE_LEVEL_COUNT; l++) {
+        const bool onStack = l < context->instStackSize;
+        neighbor.instID[l] = onStack ? context->instID[l] : RTC_INVALID_GEOMETRY_ID;
+#if defined(RTC_GEOMETRY_INSTANCE_ARRAY)
+        neighbor.instPrimID[l] = onStack ? context->instPrimID[l] : RTC_INVALID_GEOMETRY_ID;
+#endif
+      }
+      return knn->insert(neighbor,query->radius);
+    }
+
+  public:
+    Scene* scene;                      //!< top level scene of the query
+    unsigned int k;                    //!< maximal number of neighbors to find
+    unsigned int num;                  //!< number of neighbors found so far
+    RTCPointQueryNeighbor* neighbors;  //!< max heap of the neighbors found so far
+  };
+}
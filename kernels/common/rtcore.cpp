@@ -7,6 +7,7 @@
 #include "device.h"
 #include "scene.h"
 #include "context.h"
+#include "point_query_knn.h"
 #include "../geometry/filter.h"
 #include "../../include/embree4/rtcore_ray.h"
 using namespace embree;
@@ -512,6 +513,100 @@ RTC_NAMESPACE_BEGIN;
     RTC_CATCH_END2_FALSE(scene);
   }
 
+  inline unsigned int pointQueryKNN(Scene* scene, RTCPointQuery* query, unsigned int k, RTCPointQueryNeighbor* neighbors)
+  {
+    if (unlikely(k == 0))
+      return 0;
+
+    RTCPointQueryContext context;
+    rtcInitPointQueryContext(&context);
+    PointQueryKNN knn(scene, k, neighbors);
+    pointQuery(scene, query, &context, PointQueryKNN::pointQueryFunc, &knn);
+    knn.finish();
+    return knn.num;
+  }
+
+  RTC_API unsigned int rtcPointQueryKNN(RTCScene hscene, RTCPointQuery* query, unsigned int k, RTCPointQueryNeighbor* neighbors)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcPointQueryKNN);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene got not committed");
+    if (((size_t)query) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "query not aligned to 16 bytes");   
+    if (k > 0 && neighbors == nullptr) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid neighbor array");
+#endif
+    STAT3(point_query.travs,1,1,1);
+
+    return pointQueryKNN(scene, query, k, neighbors);
+    RTC_CATCH_END2_FALSE(scene);
+  }
+
+  template<int K>
+  __forceinline void pointQueryKNN(const int* valid, Scene* scene, PointQueryK<K>* queryK, unsigned int k, RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors)
+  {
+    STAT(size_t cnt=0; for (size_t i=0; i<K; i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(point_query.travs,cnt,cnt,cnt);
+
+    PointQuery query1; 
+    for (size_t i=0; i<K; i++) {
+      numNeighbors[i] = 0;
+      if (!valid[i]) continue;
+      queryK->get(i,query1);
+      numNeighbors[i] = pointQueryKNN(scene, (RTCPointQuery*)&query1, k, neighbors+i*k);
+      queryK->set(i,query1);
+    }
+  }
+
+  RTC_API void rtcPointQueryKNN4 (const int* valid, RTCScene hscene, RTCPointQuery4* query, unsigned int k, RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcPointQueryKNN4);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene got not committed");
+    if (((size_t)valid) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 16 bytes");   
+    if (((size_t)query) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "query not aligned to 16 bytes");   
+    if (k > 0 && neighbors == nullptr) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid neighbor array");
+#endif
+    pointQueryKNN<4>(valid, scene, (PointQuery4*)query, k, neighbors, numNeighbors);
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcPointQueryKNN8 (const int* valid, RTCScene hscene, RTCPointQuery8* query, unsigned int k, RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcPointQueryKNN8);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene got not committed");
+    if (((size_t)valid) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 32 bytes");   
+    if (((size_t)query) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "query not aligned to 32 bytes");   
+    if (k > 0 && neighbors == nullptr) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid neighbor array");
+#endif
+    pointQueryKNN<8>(valid, scene, (PointQuery8*)query, k, neighbors, numNeighbors);
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcPointQueryKNN16 (const int* valid, RTCScene hscene, RTCPointQuery16* query, unsigned int k, RTCPointQueryNeighbor* neighbors, unsigned int* numNeighbors)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcPointQueryKNN16);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene got not committed");
+    if (((size_t)valid) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 64 bytes");   
+    if (((size_t)query) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "query not aligned to 64 bytes");   
+    if (k > 0 && neighbors == nullptr) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid neighbor array");
+#endif
+    pointQueryKNN<16>(valid, scene, (PointQuery16*)query, k, neighbors, numNeighbors);
+    RTC_CATCH_END2(scene);
+  }
+
   RTC_API void rtcIntersect1 (RTCScene hscene, RTCRayHit* rayhit, RTCIntersectArguments* args) 
   {
     Scene* scene = (Scene*) hscene;
@@ -831,6 +926,126 @@ RTC_NAMESPACE_BEGIN;
     RTC_CATCH_END2(scene);
   }
 
+  RTC_API void rtcIntersectTile4 (const int* valid, RTCScene hscene, RTCRayHit4* rayhits, unsigned int numPackets, RTCIntersectArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcIntersectTile4);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 16 bytes");   
+    if (((size_t)rayhits) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rayhits not aligned to 16 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<4*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(normal.travs,cnt,cnt,cnt);
+
+    RTCIntersectArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitIntersectArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector4))
+      scene->intersectors.intersectTile4(valid,rayhits,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcIntersect4(valid+4*i,hscene,&rayhits[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcIntersectTile8 (const int* valid, RTCScene hscene, RTCRayHit8* rayhits, unsigned int numPackets, RTCIntersectArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcIntersectTile8);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 32 bytes");   
+    if (((size_t)rayhits) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rayhits not aligned to 32 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<8*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(normal.travs,cnt,cnt,cnt);
+
+    RTCIntersectArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitIntersectArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector8))
+      scene->intersectors.intersectTile8(valid,rayhits,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcIntersect8(valid+8*i,hscene,&rayhits[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcIntersectTile16 (const int* valid, RTCScene hscene, RTCRayHit16* rayhits, unsigned int numPackets, RTCIntersectArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcIntersectTile16);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 64 bytes");   
+    if (((size_t)rayhits) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rayhits not aligned to 64 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<16*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(normal.travs,cnt,cnt,cnt);
+
+    RTCIntersectArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitIntersectArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector16))
+      scene->intersectors.intersectTile16(valid,rayhits,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcIntersect16(valid+16*i,hscene,&rayhits[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
   RTC_API void rtcOccluded1 (RTCScene hscene, RTCRay* ray, RTCOccludedArguments* args) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1125,6 +1340,198 @@ RTC_NAMESPACE_BEGIN;
     rtcForwardOccludedN<RTCRay16,16>(valid, args, hscene, iray, instID, instPrimID);
     RTC_CATCH_END2(scene);
   }
+
+  RTC_API void rtcOccludedTile4 (const int* valid, RTCScene hscene, RTCRay4* rays, unsigned int numPackets, RTCOccludedArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcOccludedTile4);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 16 bytes");   
+    if (((size_t)rays) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rays not aligned to 16 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<4*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(shadow.travs,cnt,cnt,cnt);
+
+    RTCOccludedArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitOccludedArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector4))
+      scene->intersectors.occludedTile4(valid,rays,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcOccluded4(valid+4*i,hscene,&rays[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcOccludedTile8 (const int* valid, RTCScene hscene, RTCRay8* rays, unsigned int numPackets, RTCOccludedArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcOccludedTile8);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 32 bytes");   
+    if (((size_t)rays) & 0x1F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rays not aligned to 32 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<8*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(shadow.travs,cnt,cnt,cnt);
+
+    RTCOccludedArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitOccludedArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector8))
+      scene->intersectors.occludedTile8(valid,rays,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcOccluded8(valid+8*i,hscene,&rays[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcOccludedTile16 (const int* valid, RTCScene hscene, RTCRay16* rays, unsigned int numPackets, RTCOccludedArguments* args) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcOccludedTile16);
+
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (((size_t)valid) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "mask not aligned to 64 bytes");   
+    if (((size_t)rays) & 0x3F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "rays not aligned to 64 bytes");   
+#endif
+    STAT(size_t cnt=0; for (size_t i=0; i<16*size_t(numPackets); i++) cnt += ((int*)valid)[i] == -1;);
+    STAT3(shadow.travs,cnt,cnt,cnt);
+
+    RTCOccludedArguments defaultArgs;
+    if (unlikely(args == nullptr)) {
+      rtcInitOccludedArguments(&defaultArgs);
+      args = &defaultArgs;
+    }
+    RTCRayQueryContext* user_context = args->context;
+    
+    RTCRayQueryContext defaultContext;
+    if (unlikely(user_context == nullptr)) {
+      rtcInitRayQueryContext(&defaultContext);
+      user_context = &defaultContext;
+    }
+    RayQueryContext context(scene,user_context,args);
+
+    if (likely(scene->intersectors.intersector16))
+      scene->intersectors.occludedTile16(valid,rays,numPackets,&context);
+
+    else {
+      for (size_t i=0; i<numPackets; i++)
+        rtcOccluded16(valid+16*i,hscene,&rays[i],args);
+    }
+
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcInitTraversalContext (RTCTraversalContext* context, RTCScene hscene, RTCIntersectArguments* iargs, RTCOccludedArguments* oargs)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcInitTraversalContext);
+    RTC_VERIFY_HANDLE(hscene);
+    if (context == nullptr) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid traversal context");
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+
+    context->scene = hscene;
+    if (iargs) context->intersectArgs = *iargs;
+    else rtcInitIntersectArguments(&context->intersectArgs);
+    if (oargs) context->occludedArgs = *oargs;
+    else rtcInitOccludedArguments(&context->occludedArgs);
+    rtcInitRayQueryContext(&context->queryContext);
+
+    /* cache the single ray traversal functions selected at scene commit */
+    context->intersectors = &scene->intersectors;
+    context->intersect = (void*) scene->intersectors.intersector1.intersect;
+    context->occluded  = (void*) scene->intersectors.intersector1.occluded;
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcIntersectWithContext (RTCTraversalContext* context, RTCRayHit* rayhit)
+  {
+    Scene* scene = (Scene*) context->scene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcIntersectWithContext);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(context->scene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (context->intersectors != &scene->intersectors) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "traversal context not initialized");
+    if (context->intersect != (void*) scene->intersectors.intersector1.intersect) throw_RTCError(RTC_ERROR_INVALID_OPERATION, "scene got committed after traversal context initialization");
+    if (((size_t)rayhit) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "ray not aligned to 16 bytes");   
+#endif
+    STAT3(normal.travs,1,1,1);
+
+    RTCRayQueryContext* user_context = context->intersectArgs.context;
+    if (likely(user_context == nullptr))
+      user_context = &context->queryContext;
+    RayQueryContext qcontext(scene,user_context,&context->intersectArgs);
+
+    ((Accel::IntersectFunc) context->intersect)((Accel::Intersectors*) context->intersectors,*rayhit,&qcontext);
+#if defined(DEBUG)
+    ((RayHit*)rayhit)->verifyHit();
+#endif
+    RTC_CATCH_END2(scene);
+  }
+
+  RTC_API void rtcOccludedWithContext (RTCTraversalContext* context, RTCRay* ray)
+  {
+    Scene* scene = (Scene*) context->scene;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcOccludedWithContext);
+    STAT3(shadow.travs,1,1,1);
+#if defined(DEBUG)
+    RTC_VERIFY_HANDLE(context->scene);
+    if (scene->isModified()) throw_RTCError(RTC_ERROR_INVALID_OPERATION,"scene not committed");
+    if (context->intersectors != &scene->intersectors) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "traversal context not initialized");
+    if (context->occluded != (void*) scene->intersectors.intersector1.occluded) throw_RTCError(RTC_ERROR_INVALID_OPERATION, "scene got committed after traversal context initialization");
+    if (((size_t)ray) & 0x0F) throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "ray not aligned to 16 bytes");   
+#endif
+
+    RTCRayQueryContext* user_context = context->occludedArgs.context;
+    if (likely(user_context == nullptr))
+      user_context = &context->queryContext;
+    RayQueryContext qcontext(scene,user_context,&context->occludedArgs);
+
+    ((Accel::OccludedFunc) context->occluded)((Accel::Intersectors*) context->intersectors,*ray,&qcontext);
+    RTC_CATCH_END2(scene);
+  }
   
   RTC_API void rtcRetainScene (RTCScene hscene) 
   {
@@ -1254,6 +1661,17 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
     RTC_CATCH_END2(geometry);
   }
 
+  RTC_API void rtcSetGeometryTransformInterpolation(RTCGeometry hgeometry, RTCTransformInterpolation interpolation)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryTransformInterpolation);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->setTransformInterpolation(interpolation);
+    RTC_CATCH_END2(geometry);
+  }
+
   RTC_API void rtcGetGeometryTransform(RTCGeometry hgeometry, float time, RTCFormat format, void* xfm)
   {
     Geometry* geometry = (Geometry*) hgeometry;
@@ -1586,6 +2004,63 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
 #endif
     RTC_CATCH_END2(geometry);
   }
+
+  RTC_API void rtcSetGeometryLODRange(RTCGeometry hgeometry, float nearDistance, float farDistance)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryLODRange);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    if (!(nearDistance >= 0.0f) || !(nearDistance <= farDistance))
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"invalid LOD distance range");
+    geometry->setLODRange(nearDistance,farDistance);
+    RTC_CATCH_END2(geometry);
+  }
+
+  RTC_API RTCGeometry rtcNewCurveLODGeometry(RTCGeometry hgeometry, unsigned int segmentReduction, unsigned int strandsPerRibbon)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcNewCurveLODGeometry);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+#if defined(EMBREE_GEOMETRY_CURVE)
+    if (!(geometry->getTypeMask() & Geometry::MTY_CURVE4) || (geometry->getTypeMask() & Geometry::MTY_POINTS))
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"operation not supported for this geometry");
+    if (geometry->state != (unsigned)Geometry::State::COMMITTED)
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION,"geometry not committed");
+    if (segmentReduction == 0 || strandsPerRibbon == 0)
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"segment reduction and strands per ribbon have to be at least 1");
+
+    std::vector<unsigned int> lodCurves;
+    std::vector<std::vector<Vec3ff>> lodVertices;
+    ((CurveGeometry*)geometry)->createLOD(segmentReduction,strandsPerRibbon,lodCurves,lodVertices);
+
+    Device* device = geometry->device;
+    createCurvesTy createCurves = nullptr;
+    SELECT_SYMBOL_DEFAULT_AVX_AVX2_AVX512(device->enabled_cpu_features,createCurves);
+    Ref<Geometry> lod = createCurves(device,Geometry::GTY_FLAT_BEZIER_CURVE);
+    lod->setNumTimeSteps(geometry->numTimeSteps);
+    lod->setTimeRange(geometry->time_range);
+
+    Ref<Buffer> indexBuffer = new Buffer(device,lodCurves.size()*sizeof(unsigned int));
+    memcpy(indexBuffer->data(),lodCurves.data(),lodCurves.size()*sizeof(unsigned int));
+    lod->setBuffer(RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT,indexBuffer,0,sizeof(unsigned int),(unsigned int)lodCurves.size());
+
+    for (unsigned int t=0; t<geometry->numTimeSteps; t++)
+    {
+      Ref<Buffer> vertexBuffer = new Buffer(device,lodVertices[t].size()*sizeof(Vec3ff));
+      memcpy(vertexBuffer->data(),lodVertices[t].data(),lodVertices[t].size()*sizeof(Vec3ff));
+      lod->setBuffer(RTC_BUFFER_TYPE_VERTEX,t,RTC_FORMAT_FLOAT4,vertexBuffer,0,sizeof(Vec3ff),(unsigned int)lodVertices[t].size());
+    }
+    return (RTCGeometry) lod->refInc();
+#else
+    throw_RTCError(RTC_ERROR_UNKNOWN,"RTC_GEOMETRY_TYPE_CURVE is not supported");
+#endif
+    RTC_CATCH_END2(geometry);
+    return nullptr;
+  }
   
   RTC_API void rtcSetGeometryMask (RTCGeometry hgeometry, unsigned int mask) 
   {
@@ -1713,6 +2188,17 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
     RTC_CATCH_END2(geometry);
   }
 
+  RTC_API void rtcUpdateGeometryBufferRange (RTCGeometry hgeometry, RTCBufferType type, unsigned int slot, size_t itemOffset, size_t itemCount) 
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcUpdateGeometryBufferRange);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->updateBufferRange(type, slot, itemOffset, itemCount);
+    RTC_CATCH_END2(geometry);
+  }
+
   RTC_API void rtcDisableGeometry (RTCGeometry hgeometry) 
   {
     Geometry* geometry = (Geometry*) hgeometry;
@@ -1735,6 +2221,28 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
     RTC_CATCH_END2(geometry);
   }
 
+  RTC_API void rtcSetGeometryTessellationCamera (RTCGeometry hgeometry, float x, float y, float z, float rate)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryTessellationCamera);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->setTessellationCamera(Vec3fa(x,y,z),rate);
+    RTC_CATCH_END2(geometry);
+  }
+
+  RTC_API void rtcSetGeometryMaxDisplacement (RTCGeometry hgeometry, float maxDisplacement)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryMaxDisplacement);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->setMaxDisplacement(maxDisplacement);
+    RTC_CATCH_END2(geometry);
+  }
+
   RTC_API void rtcSetGeometryUserData (RTCGeometry hgeometry, void* ptr) 
   {
     Geometry* geometry = (Geometry*) hgeometry;
@@ -1883,6 +2391,28 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
     RTC_CATCH_END2(geometry);
   }
 
+  RTC_API void rtcSetGeometryIntersectFunctionBatch (RTCGeometry hgeometry, RTCIntersectFunctionBatch intersect) 
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryIntersectFunctionBatch);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->setIntersectFunctionBatch(intersect);
+    RTC_CATCH_END2(geometry);
+  }
+
+  RTC_API void rtcSetGeometryOccludedFunctionBatch (RTCGeometry hgeometry, RTCOccludedFunctionBatch occluded) 
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryOccludedFunctionBatch);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+    geometry->setOccludedFunctionBatch(occluded);
+    RTC_CATCH_END2(geometry);
+  }
+
   RTC_API void rtcSetGeometryIntersectFilterFunction (RTCGeometry hgeometry, RTCFilterFunctionN filter) 
   {
     Geometry* geometry = (Geometry*) hgeometry;
@@ -1905,6 +2435,20 @@ RTC_API void rtcSetGeometryTransform(RTCGeometry hgeometry, unsigned int timeSte
     RTC_CATCH_END2(geometry);
   }
 
+  RTC_API void rtcSetGeometryAlphaMask (RTCGeometry hgeometry, RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff)
+  {
+    Geometry* geometry = (Geometry*) hgeometry;
+    RTC_CATCH_BEGIN;
+    RTC_TRACE(rtcSetGeometryAlphaMask);
+    RTC_VERIFY_HANDLE(hgeometry);
+    RTC_ENTER_DEVICE(hgeometry);
+#if !defined(EMBREE_FILTER_FUNCTION)
+    throw_RTCError(RTC_ERROR_INVALID_OPERATION,"alpha masks require filter function support");
+#endif
+    geometry->setAlphaMask(format,texels,width,height,uvSlot,cutoff);
+    RTC_CATCH_END2(geometry);
+  }
+
   RTC_API void rtcSetGeometryEnableFilterFunctionFromArguments (RTCGeometry hgeometry, bool enable) 
   {
     Geometry* geometry = (Geometry*) hgeometry;
@@ -251,6 +251,106 @@ namespace embree
     maxRadiusScale = s;
   }
 
+  void CurveGeometry::setLODRange(float nearDistance, float farDistance) {
+    lodRange = BBox1f(nearDistance,farDistance);
+  }
+
+  void CurveGeometry::createLOD(unsigned int segmentReduction, unsigned int strandsPerRibbon,
+                                std::vector<unsigned int>& lodCurves, std::vector<std::vector<Vec3ff>>& lodVertices)
+  {
+    /* split curves into strands of consecutive segments that share vertices */
+    const unsigned int vertexStride = getCurveBasis() == GTY_BASIS_BEZIER ? 3 : 1;
+    std::vector<range<unsigned int>> strands;
+    for (unsigned int i=0; i<numPrimitives;)
+    {
+      unsigned int j = i+1;
+      while (j < numPrimitives && curves[j] == curves[j-1]+vertexStride) j++;
+      strands.push_back(range<unsigned int>(i,j));
+      i = j;
+    }
+
+    /* evaluates position, radius, and their derivative at normalized parameter t of a strand */
+    auto eval = [&] (const range<unsigned int>& strand, float t, unsigned int itime, Vec3ff& P, Vec3ff& dPdt)
+    {
+      const float s = t*float(strand.size());
+      const unsigned int segment = min((unsigned int)max(floorf(s),0.0f),(unsigned int)strand.size()-1);
+      RTCInterpolateArguments args;
+      args.geometry = (RTCGeometry) this;
+      args.primID = strand.begin()+segment;
+      args.u = s-float(segment);
+      args.v = 0.0f;
+      args.bufferType = RTC_BUFFER_TYPE_VERTEX;
+      args.bufferSlot = itime;
+      args.P = (float*) &P;
+      args.dPdu = (float*) &dPdt;
+      args.dPdv = nullptr;
+      args.ddPdudu = nullptr;
+      args.ddPdvdv = nullptr;
+      args.ddPdudv = nullptr;
+      args.valueCount = 4;
+      interpolate(&args);
+      dPdt *= float(strand.size());
+    };
+
+    lodCurves.clear();
+    lodVertices.clear();
+    lodVertices.resize(numTimeSteps);
+    std::vector<Vec3ff> samples(2*min(size_t(strandsPerRibbon),strands.size()));
+
+    for (size_t r=0; r<strands.size(); r+=strandsPerRibbon)
+    {
+      const size_t numStrands = min(size_t(strandsPerRibbon),strands.size()-r);
+      unsigned int numSegments = 1;
+      for (size_t i=0; i<numStrands; i++)
+        numSegments = max(numSegments,(strands[r+i].size()+segmentReduction-1)/segmentReduction);
+
+      const float dt = 1.0f/float(numSegments);
+      for (unsigned int j=0; j<numSegments; j++)
+      {
+        lodCurves.push_back((unsigned int) lodVertices[0].size());
+
+        for (unsigned int itime=0; itime<numTimeSteps; itime++)
+        {
+          /* average the strands of the ribbon at both ends of the segment */
+          Vec3ff Pavg[2] = { Vec3ff(zero), Vec3ff(zero) };
+          Vec3ff dPdtavg[2] = { Vec3ff(zero), Vec3ff(zero) };
+          for (size_t e=0; e<2; e++)
+          {
+            for (size_t i=0; i<numStrands; i++) {
+              Vec3ff dPdt;
+              eval(strands[r+i],float(j+e)*dt,itime,samples[e*numStrands+i],dPdt);
+              Pavg[e] += samples[e*numStrands+i];
+              dPdtavg[e] += dPdt;
+            }
+            Pavg[e] *= 1.0f/float(numStrands);
+            dPdtavg[e] *= 1.0f/float(numStrands);
+          }
+
+          /* widen the ribbon to cover all strands it replaces */
+          for (size_t e=0; e<2; e++)
+          {
+            float radius = Pavg[e].w;
+            for (size_t i=0; i<numStrands; i++) {
+              const Vec3ff& Pi = samples[e*numStrands+i];
+              radius = max(radius,distance(Vec3fa(Pi),Vec3fa(Pavg[e]))+Pi.w);
+            }
+            Pavg[e].w = radius;
+          }
+
+          /* convert hermite form of the segment into bezier control points */
+          Vec3ff b1 = Pavg[0] + dPdtavg[0]*(dt/3.0f);
+          Vec3ff b2 = Pavg[1] - dPdtavg[1]*(dt/3.0f);
+          b1.w = max(b1.w,0.0f);
+          b2.w = max(b2.w,0.0f);
+          lodVertices[itime].push_back(Pavg[0]);
+          lodVertices[itime].push_back(b1);
+          lodVertices[itime].push_back(b2);
+          lodVertices[itime].push_back(Pavg[1]);
+        }
+      }
+    }
+  }
+
   void CurveGeometry::addElementsToCount (GeometryCounts & counts) const 
   {
     if (numTimeSteps == 1) counts.numBezierCurves += numPrimitives; 
@@ -511,6 +611,37 @@ namespace embree
         }
       }
 
+      /*! calculates bounding box of the u-range of the i'th curve */
+      __forceinline BBox3fa bounds(const LinearSpace3fa& space, size_t i, const BBox1f& u) const
+      {
+        switch (ctype) {
+        case Geometry::GTY_SUBTYPE_FLAT_CURVE: {
+          /* flat curves get tessellated, thus we bound all line segments that overlap the u-range */
+          const Curve3ff curve = getCurveScaledRadius(space,i);
+          const int N = tessellationRate;
+          const int k0 = max(int(floor(u.lower*float(N))),0);
+          const int k1 = min(int(ceil (u.upper*float(N))),N);
+          BBox3fa bounds(empty); float r = 0.0f;
+          for (int k=k0; k<=k1; k++) {
+            const Vec3ff p = curve.eval(float(k)/float(N));
+            bounds.extend(Vec3fa(p)); r = max(r,abs(p.w));
+          }
+          return enlarge_bounds(enlarge(bounds,Vec3fa(r)));
+        }
+        case Geometry::GTY_SUBTYPE_ROUND_CURVE: {
+          /* the u-range of a cubic curve is again a cubic curve */
+          const Curve3ff curve = getCurveScaledRadius(space,i);
+          const Vec3ff p0 = curve.eval(u.lower);
+          const Vec3ff p3 = curve.eval(u.upper);
+          const Vec3ff d0 = curve.eval_du(u.lower)*(u.size()/3.0f);
+          const Vec3ff d3 = curve.eval_du(u.upper)*(u.size()/3.0f);
+          return enlarge_bounds(BezierCurve3ff(p0,p0+d0,p3-d3,p3).accurateRoundBounds());
+        }
+        case Geometry::GTY_SUBTYPE_ORIENTED_CURVE: return enlarge_bounds(getOrientedCurveScaledRadius(space,i).clip_u(Interval1f(u.lower,u.upper)).accurateBounds());
+        default: return empty;
+        }
+      }
+
       /*! calculates the linear bounds of the i'th primitive for the specified time range */
       __forceinline LBBox3fa linearBounds(size_t primID, const BBox1f& dt) const {
         return LBBox3fa([&] (size_t itime) { return bounds(primID, itime); }, dt, this->time_range, fnumTimeSegments);
@@ -584,6 +715,10 @@ namespace embree
         return bounds(ofs,scale,r_scale0,space,i,itime);
       }
 
+      BBox3fa vbounds(const LinearSpace3fa& space, size_t i, const BBox1f& u) const {
+        return bounds(space,i,u);
+      }
+
       LBBox3fa vlinearBounds(size_t primID, const BBox1f& time_range) const {
         return linearBounds(primID,time_range);
       }
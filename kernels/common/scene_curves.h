@@ -37,10 +37,20 @@ namespace embree
     bool verify();
     void setTessellationRate(float N);
     void setMaxRadiusScale(float s);
+    void setLODRange(float nearDistance, float farDistance);
     void addElementsToCount (GeometryCounts & counts) const;
 
+    /*! creates index and vertex buffers of a flat bezier curve geometry that approximates these curves */
+    void createLOD(unsigned int segmentReduction, unsigned int strandsPerRibbon,
+                   std::vector<unsigned int>& lodCurves, std::vector<std::vector<Vec3ff>>& lodVertices);
+
   public:
     
+    /*! returns true if the curves are only visible in a limited ray distance range */
+    __forceinline bool hasLODRange() const {
+      return lodRange.lower > 0.0f || lodRange.upper < float(inf);
+    }
+
     /*! returns the number of vertices */
     __forceinline size_t numVertices() const {
       return vertices[0].size();
@@ -409,6 +419,7 @@ namespace embree
     Device::vector<BufferView<char>> vertexAttribs = device; //!< user buffers
     int tessellationRate;                   //!< tessellation rate for flat curve
     float maxRadiusScale = 1.0;             //!< maximal min-width scaling of curve radii
+    BBox1f lodRange = BBox1f(0.0f,float(inf));//!< ray distance range in which the curves are visible
   };
 
   namespace isa
@@ -311,6 +311,63 @@ namespace embree
       return true;
     }
 
+    /*! calls the function for each subgrid of the grid together with its build bounds, 2x2 quad
+     *  blocks that contain invalid vertices are split into single rows or quads such that all quads
+     *  touching an invalid vertex are left out as holes */
+    template<typename Func>
+    __forceinline void foreachSubGrid(const Grid& g, const Func& func) const
+    {
+      for (unsigned int y=0; y<g.resY-1u; y+=2)
+      {
+        for (unsigned int x=0; x<g.resX-1u; x+=2)
+        {
+          const unsigned int flagsX = g.get3x3FlagsX(x);
+          const unsigned int flagsY = g.get3x3FlagsY(y);
+
+          BBox3fa bounds = empty;
+          if (likely(buildBounds(g,x,y,bounds))) {
+            func(x | flagsX, y | flagsY, bounds);
+            continue;
+          }
+
+          const unsigned int quadsX = flagsX ? 1 : 2;
+          const unsigned int quadsY = flagsY ? 1 : 2;
+          for (unsigned int iy=0; iy<quadsY; iy++)
+          {
+            BBox3fa quadBounds[2] = { empty, empty };
+            bool quadValid[2] = { false, false };
+            for (unsigned int ix=0; ix<quadsX; ix++)
+              quadValid[ix] = buildBoundsQuad(g,x+ix,y+iy,quadBounds[ix]);
+
+            if (quadValid[0] && (quadsX == 1 || quadValid[1]))
+              func(x | flagsX, (y+iy) | (1<<15), merge(quadBounds[0],quadBounds[1]));
+            else
+              for (unsigned int ix=0; ix<quadsX; ix++)
+                if (quadValid[ix]) func((x+ix) | (1<<15), (y+iy) | (1<<15), quadBounds[ix]);
+          }
+        }
+      }
+    }
+
+    /*! returns the number of subgrids of the i'th grid, excluding the holes of invalid vertices */
+    __forceinline unsigned int getNumValidSubGrids(const size_t gridID) const
+    {
+      if (!validRange(gridID)) return 0;
+      unsigned int num = 0;
+      foreachSubGrid(grid(gridID),[&] (unsigned int x, unsigned int y, const BBox3fa& bounds) { num++; });
+      return num;
+    }
+
+    /*! check if all vertices of the i'th grid are inside the vertex buffer */
+    __forceinline bool validRange(size_t gridID) const
+    {
+      if (unlikely(gridID >= grids.size())) return false;
+      const Grid &g = grid(gridID);
+      if (unlikely(g.startVtxID + 0                                     >= vertices0.size())) return false;
+      if (unlikely(g.startVtxID + (g.resY-1)*g.lineVtxOffset + g.resX-1 >= vertices0.size())) return false;
+      return true;
+    }
+
     __forceinline bool valid(size_t gridID, size_t itime=0) const {
       return valid(gridID, make_range(itime, itime));
     }
@@ -318,10 +375,8 @@ namespace embree
     /*! check if the i'th primitive is valid between the specified time range */
     __forceinline bool valid(size_t gridID, const range<size_t>& itime_range) const
     {
-      if (unlikely(gridID >= grids.size())) return false;
+      if (unlikely(!validRange(gridID))) return false;
       const Grid &g = grid(gridID);
-      if (unlikely(g.startVtxID + 0                                     >= vertices0.size())) return false;
-      if (unlikely(g.startVtxID + (g.resY-1)*g.lineVtxOffset + g.resX-1 >= vertices0.size())) return false;
 
       for (size_t y=0;y<g.resY;y++)
         for (size_t x=0;x<g.resX;x++)
@@ -404,21 +459,13 @@ namespace embree
         PrimInfo pinfo(empty);
         for (size_t j=r.begin(); j<r.end(); j++)
         {
-          if (!valid(j)) continue;
-          const GridMesh::Grid &g = grid(j);
-          
-          for (unsigned int y=0; y<g.resY-1u; y+=2)
-          {
-            for (unsigned int x=0; x<g.resX-1u; x+=2)
-            {
-              BBox3fa bounds = empty;
-              if (!buildBounds(g,x,y,bounds)) continue; // get bounds of subgrid
+          if (!validRange(j)) continue;
+          foreachSubGrid(grid(j),[&] (unsigned int x, unsigned int y, const BBox3fa& bounds) {
               const PrimRef prim(bounds,(unsigned)geomID,(unsigned)k);
               pinfo.add_center2(prim);
-              sgrids[k] = SubGridBuildData(x | g.get3x3FlagsX(x), y | g.get3x3FlagsY(y), unsigned(j));
-              prims[k++] = prim;                
-            }
-          }
+              sgrids[k] = SubGridBuildData(x, y, unsigned(j));
+              prims[k++] = prim;
+            });
         }
         return pinfo;
       }
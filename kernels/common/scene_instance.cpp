@@ -11,6 +11,7 @@ namespace embree
   Instance::Instance (Device* device, Accel* object, unsigned int numTimeSteps)
     : Geometry(device,Geometry::GTY_INSTANCE_CHEAP,1,numTimeSteps)
     , object(object)
+    , interpolation(RTC_TRANSFORM_INTERPOLATION_LINEAR)
     , local2world(nullptr)
   {
     if (object) object->refInc();
@@ -103,7 +104,7 @@ namespace embree
       throw_RTCError(RTC_ERROR_INVALID_OPERATION,"invalid timestep");
 
     local2world[timeStep] = xfm;
-    gsubtype = GTY_SUBTYPE_INSTANCE_LINEAR;
+    gsubtype = interpolation == RTC_TRANSFORM_INTERPOLATION_CUBIC ? GTY_SUBTYPE_INSTANCE_CUBIC : GTY_SUBTYPE_INSTANCE_LINEAR;
     Geometry::update();
   }
 
@@ -117,6 +118,19 @@ namespace embree
     Geometry::update();
   }
 
+  void Instance::setTransformInterpolation(RTCTransformInterpolation interpolation_in)
+  {
+    if (interpolation_in != RTC_TRANSFORM_INTERPOLATION_LINEAR && interpolation_in != RTC_TRANSFORM_INTERPOLATION_CUBIC)
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"invalid transform interpolation");
+
+    interpolation = interpolation_in;
+
+    /* quaternion decompositions are always interpolated with slerp */
+    if (gsubtype != GTY_SUBTYPE_INSTANCE_QUATERNION)
+      gsubtype = interpolation == RTC_TRANSFORM_INTERPOLATION_CUBIC ? GTY_SUBTYPE_INSTANCE_CUBIC : GTY_SUBTYPE_INSTANCE_LINEAR;
+    Geometry::update();
+  }
+
   AffineSpace3fa Instance::getTransform(float time)
   {
     if (likely(numTimeSteps <= 1))
@@ -292,6 +306,71 @@ namespace embree
     return delta;
   }
 
+  /*
+     This function calculates the correction for the linear bounds
+     bbox0/bbox1 to properly bound the motion obtained by evaluating
+     the cubic spline segment of the transformations and applying it
+     to the linearly blended positions. The derivative of the error to
+     the linearly blended bounds is a cubic polynomial whose roots get
+     found with the same root solver as for quaternion motion.
+  */
+
+  BBox3fa boundSegmentCubic(CubicMotionDerivativeCoefficients const& motionDerivCoeffs,
+                            AffineSpace3fa const& xfm0,
+                            AffineSpace3fa const& xfm1,
+                            AffineSpace3fa const& xfm2,
+                            AffineSpace3fa const& xfm3,
+                            BBox3fa const& obbox0,
+                            BBox3fa const& obbox1,
+                            BBox3fa const& bbox0,
+                            BBox3fa const& bbox1,
+                            float tmin,
+                            float tmax)
+  {
+    BBox3fa delta(Vec3fa(0.f), Vec3fa(0.f));
+    float roots[32];
+    unsigned int maxNumRoots = 32;
+    unsigned int numRoots;
+    const Interval1f interval(tmin, tmax);
+
+    // loop over bounding box corners
+    for (int ii = 0; ii < 2; ++ii)
+    for (int jj = 0; jj < 2; ++jj)
+    for (int kk = 0; kk < 2; ++kk)
+    {
+      Vec3fa p0(ii == 0 ? obbox0.lower.x : obbox0.upper.x,
+                jj == 0 ? obbox0.lower.y : obbox0.upper.y,
+                kk == 0 ? obbox0.lower.z : obbox0.upper.z);
+      Vec3fa p1(ii == 0 ? obbox1.lower.x : obbox1.upper.x,
+                jj == 0 ? obbox1.lower.y : obbox1.upper.y,
+                kk == 0 ? obbox1.lower.z : obbox1.upper.z);
+
+      // get extrema of motion of bounding box corner for each dimension
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        CubicMotionDerivative motionDerivative(motionDerivCoeffs, dim, p0, p1);
+
+        numRoots = motionDerivative.findRoots(interval, bbox0.lower[dim] - bbox1.lower[dim], roots, maxNumRoots);
+        for (unsigned int r = 0; r < numRoots; ++r) {
+          float t = roots[r];
+          const BBox3fa bt = lerp(bbox0, bbox1, t);
+          const Vec3fa  pt = xfmPoint(cubic(xfm0, xfm1, xfm2, xfm3, t), lerp(p0, p1, t));
+          delta.lower[dim] = std::min(delta.lower[dim], pt[dim] - bt.lower[dim]);
+        }
+
+        numRoots = motionDerivative.findRoots(interval, bbox0.upper[dim] - bbox1.upper[dim], roots, maxNumRoots);
+        for (unsigned int r = 0; r < numRoots; ++r) {
+          float t = roots[r];
+          const BBox3fa bt = lerp(bbox0, bbox1, t);
+          const Vec3fa  pt = xfmPoint(cubic(xfm0, xfm1, xfm2, xfm3, t), lerp(p0, p1, t));
+          delta.upper[dim] = std::max(delta.upper[dim], pt[dim] - bt.upper[dim]);
+        }
+      }
+    }
+
+    return delta;
+  }
+
   BBox3fa Instance::boundSegment(size_t itime,
       BBox3fa const& obbox0, BBox3fa const& obbox1,
       BBox3fa const& bbox0, BBox3fa const& bbox1,
@@ -302,6 +381,13 @@ namespace embree
       auto const& xfm1 = local2world[itime+1];
       MotionDerivativeCoefficients motionDerivCoeffs(local2world[itime+0], local2world[itime+1]);
       return boundSegmentNonlinear(motionDerivCoeffs, xfm0, xfm1, obbox0, obbox1, bbox0, bbox1, tmin, tmax);
+    } else if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC)) {
+      const AffineSpace3fa xfm0 = local2world[itime > 0 ? itime-1 : 0];
+      const AffineSpace3fa xfm1 = local2world[itime+0];
+      const AffineSpace3fa xfm2 = local2world[itime+1];
+      const AffineSpace3fa xfm3 = local2world[min(itime+2,size_t(numTimeSteps-1))];
+      CubicMotionDerivativeCoefficients motionDerivCoeffs(xfm0, xfm1, xfm2, xfm3);
+      return boundSegmentCubic(motionDerivCoeffs, xfm0, xfm1, xfm2, xfm3, obbox0, obbox1, bbox0, bbox1, tmin, tmax);
     } else {
       auto const& xfm0 = local2world[itime];
       auto const& xfm1 = local2world[itime+1];
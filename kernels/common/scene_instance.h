@@ -40,6 +40,9 @@ namespace embree
       if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
         return xfmBounds(slerp(local2world[itime0], local2world[itime1], f),
                          lerp(getObjectBounds(itime0), getObjectBounds(itime1), f));
+      if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+        return xfmBounds(itime0 < itime1 ? getLocal2WorldCubic(itime0, f) : getLocal2WorldCubic(itime1, 1.0f-f),
+                         lerp(getObjectBounds(itime0), getObjectBounds(itime1), f));
       return xfmBounds(lerp(local2world[itime0], local2world[itime1], f),
                         lerp(getObjectBounds(itime0), getObjectBounds(itime1), f));
     }
@@ -49,6 +52,7 @@ namespace embree
     virtual void setInstancedScene(const Ref<Scene>& scene) override;
     virtual void setTransform(const AffineSpace3fa& local2world, unsigned int timeStep) override;
     virtual void setQuaternionDecomposition(const AffineSpace3ff& qd, unsigned int timeStep) override;
+    virtual void setTransformInterpolation(RTCTransformInterpolation interpolation) override;
     virtual AffineSpace3fa getTransform(float time) override;
     virtual AffineSpace3fa getTransform(size_t, float time) override;
     virtual void setMask (unsigned mask) override;
@@ -137,6 +141,8 @@ namespace embree
         float ftime; const unsigned int itime = timeSegment(t, ftime);
         if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
           return slerp(local2world[itime+0],local2world[itime+1],ftime);
+        if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+          return getLocal2WorldCubic(itime,ftime);
         return lerp(local2world[itime+0],local2world[itime+1],ftime);
       }
       return getLocal2World();
@@ -157,6 +163,8 @@ namespace embree
     {
       if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
         return getWorld2LocalSlerp<K>(valid, t);
+      if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+        return getWorld2LocalCubic<K>(valid, t);
       return getWorld2LocalLerp<K>(valid, t);
     }
 
@@ -166,6 +174,16 @@ namespace embree
 
     private:
 
+    /* evaluates the spline segment itime, the first and last keys get repeated at the borders */
+    __forceinline AffineSpace3fa getLocal2WorldCubic(size_t itime, float f) const
+    {
+      return cubic(AffineSpace3fa(local2world[itime > 0 ? itime-1 : 0]),
+                   AffineSpace3fa(local2world[itime+0]),
+                   AffineSpace3fa(local2world[itime+1]),
+                   AffineSpace3fa(local2world[min(itime+2,size_t(numTimeSteps-1))]),
+                   f);
+    }
+
     template<int K>
     __forceinline AffineSpace3vf<K> getWorld2LocalSlerp(const vbool<K>& valid, const vfloat<K>& t) const
     {
@@ -217,8 +235,28 @@ namespace embree
       }
     }
 
+    template<int K>
+    __forceinline AffineSpace3vf<K> getWorld2LocalCubic(const vbool<K>& valid, const vfloat<K>& t) const
+    {
+      vfloat<K> ftime;
+      const vint<K> itime_k = timeSegment<K>(t, ftime);
+      assert(any(valid));
+      AffineSpace3vf<K> space0,space1,space2,space3;
+      vbool<K> valid1 = valid;
+      while (any(valid1)) {
+        vbool<K> valid2;
+        const int itime = next_unique(valid1, itime_k, valid2);
+        space0 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)local2world[max(itime-1,0)]), space0);
+        space1 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)local2world[itime+0]), space1);
+        space2 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)local2world[itime+1]), space2);
+        space3 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)local2world[min(itime+2,int(numTimeSteps-1))]), space3);
+      }
+      return rcp(cubic(space0, space1, space2, space3, ftime));
+    }
+
   public:
     Accel* object;                 //!< pointer to instanced acceleration structure
+    RTCTransformInterpolation interpolation; //!< interpolation of the transformations between time steps
     AffineSpace3ff* local2world;   //!< transformation from local space to world space for each timestep (either normal matrix or quaternion decomposition)
     AffineSpace3fa world2local0;   //!< transformation from world space to local space for timestep 0
   };
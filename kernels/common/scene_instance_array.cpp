@@ -4,6 +4,7 @@
 #include "scene_instance_array.h"
 #include "scene.h"
 #include "motion_derivative.h"
+#include "../../common/algorithms/parallel_for.h"
 namespace embree
 {
 #if defined(EMBREE_LOWEST_ISA)
@@ -85,6 +86,17 @@ namespace embree
       return getLocal2World(i, time);
   }
 
+  void InstanceArray::setTransformInterpolation(RTCTransformInterpolation interpolation)
+  {
+    if (interpolation != RTC_TRANSFORM_INTERPOLATION_LINEAR && interpolation != RTC_TRANSFORM_INTERPOLATION_CUBIC)
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT,"invalid transform interpolation");
+
+    /* quaternion decompositions are always interpolated with slerp */
+    if (gsubtype != GTY_SUBTYPE_INSTANCE_QUATERNION)
+      gsubtype = interpolation == RTC_TRANSFORM_INTERPOLATION_CUBIC ? GTY_SUBTYPE_INSTANCE_CUBIC : GTY_SUBTYPE_INSTANCE_LINEAR;
+    Geometry::update();
+  }
+
   void InstanceArray::setBuffer(RTCBufferType type, unsigned int slot, RTCFormat format, const Ref<Buffer>& buffer, size_t offset, size_t stride, unsigned int num)
   {
     /* verify that all accesses are 4 bytes aligned */
@@ -96,7 +108,8 @@ namespace embree
       if ((format != RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR)
        && (format != RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR)
        && (format != RTC_FORMAT_FLOAT3X4_ROW_MAJOR)
-       && (format != RTC_FORMAT_QUATERNION_DECOMPOSITION))
+       && (format != RTC_FORMAT_QUATERNION_DECOMPOSITION)
+       && !isCompressedFormat(format))
         throw_RTCError(RTC_ERROR_INVALID_OPERATION, "invalid transform buffer format");
 
       if (slot >= l2w_buf.size())
@@ -118,6 +131,19 @@ namespace embree
 
       object_ids.set(buffer, offset, stride, num, format);
     }
+    else if (type == RTC_BUFFER_TYPE_TRANSFORM_PALETTE)
+    {
+      if ((format != RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR)
+       && (format != RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR)
+       && (format != RTC_FORMAT_FLOAT3X4_ROW_MAJOR))
+        throw_RTCError(RTC_ERROR_INVALID_OPERATION, "invalid transform palette buffer format");
+
+      if (slot != 0)
+        throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid transform palette buffer slot. must be 0.");
+
+      palette_buf.set(buffer, offset, stride, num, format);
+      palette_buf.checkPadding16();
+    }
     else
       throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "unknown buffer type");
   }
@@ -136,6 +162,12 @@ namespace embree
         throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid index buffer slot. must be 0");
       return object_ids.getPtr();
     }
+    else if (type == RTC_BUFFER_TYPE_TRANSFORM_PALETTE)
+    {
+      if (slot != 0)
+        throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid transform palette buffer slot. must be 0");
+      return palette_buf.getPtr();
+    }
     else
     {
       throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "unknown buffer type");
@@ -157,6 +189,12 @@ namespace embree
         throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid index buffer slot. must be 0");
       object_ids.setModified();
     }
+    else if (type == RTC_BUFFER_TYPE_TRANSFORM_PALETTE)
+    {
+      if (slot != 0)
+        throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid transform palette buffer slot. must be 0");
+      palette_buf.setModified();
+    }
     else
     {
       throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "unknown buffer type");
@@ -187,6 +225,32 @@ namespace embree
       if (object) object->refInc();
     }
 
+    bool palette = false;
+    for (size_t t = 0; t < l2w_buf.size(); t++)
+      palette |= l2w_buf[t].getFormat() == RTC_FORMAT_TRANSLATION_PALETTE_INDEX;
+    if (palette && !palette_buf) {
+      throw_RTCError(RTC_ERROR_INVALID_OPERATION, "transform palette buffer not set.");
+    }
+
+    /* cache the inverse transformations such that the intersectors do not have to invert them per ray,
+     * for compressed transformations only the inverse palette gets cached to keep the memory footprint low */
+    world2local0.clear();
+    palette_world2local.clear();
+    if (palette)
+    {
+      palette_world2local.resize(palette_buf.size());
+      for (size_t i=0; i<palette_buf.size(); i++)
+        palette_world2local[i] = rcp(AffineSpace3fa(decodeTransform(palette_buf, i)));
+    }
+    if (numTimeSteps == 1 && !isCompressedFormat(l2w_buf[0].getFormat()))
+    {
+      world2local0.resize(numPrimitives);
+      parallel_for(size_t(0), size_t(numPrimitives), size_t(4096), [&](const range<size_t>& r) {
+        for (size_t i=r.begin(); i<r.end(); i++)
+          world2local0[i] = rcp(getLocal2World(i));
+      });
+    }
+
     Geometry::commit();
   }
 
@@ -332,6 +396,71 @@ namespace embree
     return delta;
   }
 
+  /*
+     This function calculates the correction for the linear bounds
+     bbox0/bbox1 to properly bound the motion obtained by evaluating
+     the cubic spline segment of the transformations and applying it
+     to the linearly blended positions. The derivative of the error to
+     the linearly blended bounds is a cubic polynomial whose roots get
+     found with the same root solver as for quaternion motion.
+  */
+
+  BBox3fa boundSegmentCubic(CubicMotionDerivativeCoefficients const& motionDerivCoeffs,
+                            AffineSpace3fa const& xfm0,
+                            AffineSpace3fa const& xfm1,
+                            AffineSpace3fa const& xfm2,
+                            AffineSpace3fa const& xfm3,
+                            BBox3fa const& obbox0,
+                            BBox3fa const& obbox1,
+                            BBox3fa const& bbox0,
+                            BBox3fa const& bbox1,
+                            float tmin,
+                            float tmax)
+  {
+    BBox3fa delta(Vec3fa(0.f), Vec3fa(0.f));
+    float roots[32];
+    unsigned int maxNumRoots = 32;
+    unsigned int numRoots;
+    const Interval1f interval(tmin, tmax);
+
+    // loop over bounding box corners
+    for (int ii = 0; ii < 2; ++ii)
+    for (int jj = 0; jj < 2; ++jj)
+    for (int kk = 0; kk < 2; ++kk)
+    {
+      Vec3fa p0(ii == 0 ? obbox0.lower.x : obbox0.upper.x,
+                jj == 0 ? obbox0.lower.y : obbox0.upper.y,
+                kk == 0 ? obbox0.lower.z : obbox0.upper.z);
+      Vec3fa p1(ii == 0 ? obbox1.lower.x : obbox1.upper.x,
+                jj == 0 ? obbox1.lower.y : obbox1.upper.y,
+                kk == 0 ? obbox1.lower.z : obbox1.upper.z);
+
+      // get extrema of motion of bounding box corner for each dimension
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        CubicMotionDerivative motionDerivative(motionDerivCoeffs, dim, p0, p1);
+
+        numRoots = motionDerivative.findRoots(interval, bbox0.lower[dim] - bbox1.lower[dim], roots, maxNumRoots);
+        for (unsigned int r = 0; r < numRoots; ++r) {
+          float t = roots[r];
+          const BBox3fa bt = lerp(bbox0, bbox1, t);
+          const Vec3fa  pt = xfmPoint(cubic(xfm0, xfm1, xfm2, xfm3, t), lerp(p0, p1, t));
+          delta.lower[dim] = std::min(delta.lower[dim], pt[dim] - bt.lower[dim]);
+        }
+
+        numRoots = motionDerivative.findRoots(interval, bbox0.upper[dim] - bbox1.upper[dim], roots, maxNumRoots);
+        for (unsigned int r = 0; r < numRoots; ++r) {
+          float t = roots[r];
+          const BBox3fa bt = lerp(bbox0, bbox1, t);
+          const Vec3fa  pt = xfmPoint(cubic(xfm0, xfm1, xfm2, xfm3, t), lerp(p0, p1, t));
+          delta.upper[dim] = std::max(delta.upper[dim], pt[dim] - bt.upper[dim]);
+        }
+      }
+    }
+
+    return delta;
+  }
+
   }
 
   BBox3fa InstanceArray::boundSegment(size_t i, size_t itime,
@@ -344,6 +473,13 @@ namespace embree
       auto const& xfm1 = l2w(i, itime+1);
       MotionDerivativeCoefficients motionDerivCoeffs(xfm0, xfm1);
       return boundSegmentNonlinear(motionDerivCoeffs, xfm0, xfm1, obbox0, obbox1, bbox0, bbox1, tmin, tmax);
+    } else if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC)) {
+      const AffineSpace3fa xfm0 = l2w(i, itime > 0 ? itime-1 : 0);
+      const AffineSpace3fa xfm1 = l2w(i, itime+0);
+      const AffineSpace3fa xfm2 = l2w(i, itime+1);
+      const AffineSpace3fa xfm3 = l2w(i, min(itime+2,size_t(numTimeSteps-1)));
+      CubicMotionDerivativeCoefficients motionDerivCoeffs(xfm0, xfm1, xfm2, xfm3);
+      return boundSegmentCubic(motionDerivCoeffs, xfm0, xfm1, xfm2, xfm3, obbox0, obbox1, bbox0, bbox1, tmin, tmax);
     } else {
       auto const& xfm0 = getLocal2World(i, itime);
       auto const& xfm1 = getLocal2World(i, itime+1);
@@ -41,6 +41,9 @@ namespace embree
       if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
         return xfmBounds(slerp(l2w(i, itime0), l2w(i, itime1), f),
                          lerp(getObjectBounds(i, itime0), getObjectBounds(i, itime1), f));
+      if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+        return xfmBounds(itime0 < itime1 ? getLocal2WorldCubic(i, itime0, f) : getLocal2WorldCubic(i, itime1, 1.0f-f),
+                         lerp(getObjectBounds(i, itime0), getObjectBounds(i, itime1), f));
       return xfmBounds(lerp(l2w(i, itime0), l2w(i, itime1), f),
                         lerp(getObjectBounds(i, itime0), getObjectBounds(i, itime1), f));
     }
@@ -54,6 +57,7 @@ namespace embree
     virtual void setNumTimeSteps (unsigned int numTimeSteps) override;
     virtual void setInstancedScene(const Ref<Scene>& scene) override;
     virtual void setInstancedScenes(const RTCScene* scenes, size_t numScenes) override;
+    virtual void setTransformInterpolation(RTCTransformInterpolation interpolation) override;
     virtual AffineSpace3fa getTransform(size_t, float time) override;
     virtual void setMask (unsigned mask) override;
     virtual void build() {}
@@ -160,16 +164,34 @@ namespace embree
         float ftime; const unsigned int itime = timeSegment(t, ftime);
         if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
           return slerp(l2w(i, itime+0),l2w(i, itime+1),ftime);
+        if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+          return getLocal2WorldCubic(i, itime, ftime);
         return lerp(l2w(i, itime+0),l2w(i, itime+1),ftime);
       }
       return getLocal2World(i);
     }
 
     __forceinline AffineSpace3fa getWorld2Local(size_t i) const {
+      if (likely(world2local0.size()))
+        return world2local0[i];
+
+      /* compressed formats are not cached, but translations are cheap to invert */
+      if (l2w_buf[0].getFormat() == RTC_FORMAT_TRANSLATION_FLOAT3) {
+        const float* t = (const float*) l2w_buf[0].getPtr(i);
+        return AffineSpace3fa::translate(-Vec3fa(t[0],t[1],t[2]));
+      }
+      else if (l2w_buf[0].getFormat() == RTC_FORMAT_TRANSLATION_PALETTE_INDEX) {
+        const TranslationPaletteIndex* tp = (const TranslationPaletteIndex*) l2w_buf[0].getPtr(i);
+        assert(tp->index < palette_world2local.size());
+        const AffineSpace3fa& w2l = palette_world2local[tp->index];
+        return AffineSpace3fa(w2l.l, w2l.p - xfmVector(w2l, Vec3fa(tp->x,tp->y,tp->z)));
+      }
       return rcp(getLocal2World(i));
     }
 
     __forceinline AffineSpace3fa getWorld2Local(size_t i, float t) const {
+      if (numTimeSegments() == 0)
+        return getWorld2Local(i);
       return rcp(getLocal2World(i, t));
     }
 
@@ -178,6 +200,8 @@ namespace embree
     {
       if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_QUATERNION))
         return getWorld2LocalSlerp<K>(i, valid, t);
+      if (unlikely(gsubtype == GTY_SUBTYPE_INSTANCE_CUBIC))
+        return getWorld2LocalCubic<K>(i, valid, t);
       return getWorld2LocalLerp<K>(i, valid, t);
     }
 
@@ -201,6 +225,16 @@ namespace embree
 
     private:
 
+    /* evaluates the spline segment itime, the first and last keys get repeated at the borders */
+    __forceinline AffineSpace3fa getLocal2WorldCubic(size_t i, size_t itime, float f) const
+    {
+      return cubic(AffineSpace3fa(l2w(i, itime > 0 ? itime-1 : 0)),
+                   AffineSpace3fa(l2w(i, itime+0)),
+                   AffineSpace3fa(l2w(i, itime+1)),
+                   AffineSpace3fa(l2w(i, min(itime+2,size_t(numTimeSteps-1)))),
+                   f);
+    }
+
     template<int K>
     __forceinline AffineSpace3vf<K> getWorld2LocalSlerp(size_t i, const vbool<K>& valid, const vfloat<K>& t) const
     {
@@ -252,15 +286,70 @@ namespace embree
       }
     }
 
+    template<int K>
+    __forceinline AffineSpace3vf<K> getWorld2LocalCubic(size_t i, const vbool<K>& valid, const vfloat<K>& t) const
+    {
+      vfloat<K> ftime;
+      const vint<K> itime_k = timeSegment<K>(t, ftime);
+      assert(any(valid));
+      AffineSpace3vf<K> space0,space1,space2,space3;
+      vbool<K> valid1 = valid;
+      while (any(valid1)) {
+        vbool<K> valid2;
+        const int itime = next_unique(valid1, itime_k, valid2);
+        space0 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)l2w(i, max(itime-1,0))), space0);
+        space1 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)l2w(i, itime+0)), space1);
+        space2 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)l2w(i, itime+1)), space2);
+        space3 = select(valid2, AffineSpace3vf<K>((AffineSpace3fa)l2w(i, min(itime+2,int(numTimeSteps-1)))), space3);
+      }
+      return rcp(cubic(space0, space1, space2, space3, ftime));
+    }
+
   private:
 
-    __forceinline AffineSpace3ff l2w(size_t i, size_t itime) const {
-      if (l2w_buf[itime].getFormat() == RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR) {
-        return *(AffineSpace3ff*)(l2w_buf[itime].getPtr(i));
+    /* layout of the elements of RTC_FORMAT_TRANSLATION_PALETTE_INDEX buffers */
+    struct TranslationPaletteIndex
+    {
+      float x, y, z;
+      unsigned int index;
+    };
+
+    static __forceinline bool isCompressedFormat(RTCFormat format) {
+      return format == RTC_FORMAT_TRANSLATION_FLOAT3 || format == RTC_FORMAT_TRANSLATION_PALETTE_INDEX || format == RTC_FORMAT_HALF3X4_COLUMN_MAJOR;
+    }
+
+    __forceinline AffineSpace3ff l2w(size_t i, size_t itime) const
+    {
+      const RawBufferView& buf = l2w_buf[itime];
+      if (buf.getFormat() == RTC_FORMAT_TRANSLATION_FLOAT3) {
+        const float* t = (const float*) buf.getPtr(i);
+        AffineSpace3ff transform(one);
+        transform.p.x = t[0];
+        transform.p.y = t[1];
+        transform.p.z = t[2];
+        return transform;
+      }
+      else if (buf.getFormat() == RTC_FORMAT_TRANSLATION_PALETTE_INDEX) {
+        const TranslationPaletteIndex* tp = (const TranslationPaletteIndex*) buf.getPtr(i);
+        assert(tp->index < palette_buf.size());
+        AffineSpace3ff transform = decodeTransform(palette_buf, tp->index);
+        transform.p.x += tp->x;
+        transform.p.y += tp->y;
+        transform.p.z += tp->z;
+        return transform;
       }
-      else if(l2w_buf[itime].getFormat() == RTC_FORMAT_QUATERNION_DECOMPOSITION) {
+      return decodeTransform(buf, i);
+    }
+
+    /* decodes the i'th transformation of a transform or palette buffer */
+    static __forceinline AffineSpace3ff decodeTransform(const RawBufferView& buf, size_t i)
+    {
+      if (buf.getFormat() == RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR) {
+        return *(AffineSpace3ff*)(buf.getPtr(i));
+      }
+      else if(buf.getFormat() == RTC_FORMAT_QUATERNION_DECOMPOSITION) {
         AffineSpace3ff transform;
-        QuaternionDecomposition* qd = (QuaternionDecomposition*)l2w_buf[itime].getPtr(i);
+        QuaternionDecomposition* qd = (QuaternionDecomposition*)buf.getPtr(i);
         transform.l.vx.x = qd->scale_x;
         transform.l.vy.y = qd->scale_y;
         transform.l.vz.z = qd->scale_z;
@@ -282,12 +371,21 @@ namespace embree
         transform.p.w    = q.r;
         return transform;
       }
-      else if (l2w_buf[itime].getFormat() == RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR) {
-        AffineSpace3f* l2w = reinterpret_cast<AffineSpace3f*>(l2w_buf[itime].getPtr(i));
+      else if (buf.getFormat() == RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR) {
+        AffineSpace3f* l2w = reinterpret_cast<AffineSpace3f*>(buf.getPtr(i));
         return AffineSpace3ff(*l2w);
       }
-      else if (l2w_buf[itime].getFormat() == RTC_FORMAT_FLOAT3X4_ROW_MAJOR) {
-        float* data = reinterpret_cast<float*>(l2w_buf[itime].getPtr(i));
+      else if (buf.getFormat() == RTC_FORMAT_HALF3X4_COLUMN_MAJOR) {
+        const unsigned short* data = reinterpret_cast<const unsigned short*>(buf.getPtr(i));
+        AffineSpace3f l2w;
+        l2w.l.vx.x = half2float(data[0]); l2w.l.vx.y = half2float(data[1]);  l2w.l.vx.z = half2float(data[2]);
+        l2w.l.vy.x = half2float(data[3]); l2w.l.vy.y = half2float(data[4]);  l2w.l.vy.z = half2float(data[5]);
+        l2w.l.vz.x = half2float(data[6]); l2w.l.vz.y = half2float(data[7]);  l2w.l.vz.z = half2float(data[8]);
+        l2w.p.x    = half2float(data[9]); l2w.p.y    = half2float(data[10]); l2w.p.z    = half2float(data[11]);
+        return l2w;
+      }
+      else if (buf.getFormat() == RTC_FORMAT_FLOAT3X4_ROW_MAJOR) {
+        float* data = reinterpret_cast<float*>(buf.getPtr(i));
         AffineSpace3f l2w;
         l2w.l.vx.x = data[0]; l2w.l.vy.x = data[1]; l2w.l.vz.x = data[2]; l2w.p.x = data[3];
         l2w.l.vx.y = data[4]; l2w.l.vy.y = data[5]; l2w.l.vz.y = data[6]; l2w.p.y = data[7];
@@ -308,6 +406,9 @@ namespace embree
     uint32_t numObjects;
     Device::vector<RawBufferView> l2w_buf = device; //!< transformation from local space to world space for each timestep (either normal matrix or quaternion decomposition)
     BufferView<uint32_t> object_ids; //!< array of scene ids per instance array primitive
+    RawBufferView palette_buf;       //!< shared transformations referenced by RTC_FORMAT_TRANSLATION_PALETTE_INDEX transform buffers
+    Device::vector<AffineSpace3fa> world2local0 = device; //!< cached transformation from world space to local space for timestep 0 of each instance array primitive
+    Device::vector<AffineSpace3fa> palette_world2local = device; //!< cached inverse of each palette transformation
   };
 
   namespace isa
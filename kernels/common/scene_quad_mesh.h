@@ -5,6 +5,7 @@
 
 #include "geometry.h"
 #include "buffer.h"
+#include "alpha_mask.h"
 
 namespace embree
 {
@@ -44,6 +45,7 @@ namespace embree
     void setBuffer(RTCBufferType type, unsigned int slot, RTCFormat format, const Ref<Buffer>& buffer, size_t offset, size_t stride, unsigned int num);
     void* getBuffer(RTCBufferType type, unsigned int slot);
     void updateBuffer(RTCBufferType type, unsigned int slot);
+    void setAlphaMask (RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff);
     void commit();
     bool verify();
     void interpolate(const RTCInterpolateArguments* const args);
@@ -294,11 +296,21 @@ namespace embree
 	areaProjectedTriangle(v1,v2,v3);
     }
 
+    /*! tests the alpha mask at the hit location u/v of the i'th quad */
+    __forceinline bool alphaMaskOpaque(size_t i, float u, float v) const
+    {
+      const Quad& q = quad(i);
+      const RawBufferView& uvs = vertexAttribs[alphaMask.uvSlot];
+      if (u+v <= 1.0f) return alphaMask.opaque(uvs,q.v[0],q.v[1],q.v[3],u,v);
+      else             return alphaMask.opaque(uvs,q.v[2],q.v[3],q.v[1],1.0f-u,1.0f-v);
+    }
+
   public:
     BufferView<Quad> quads;                 //!< array of quads
     BufferView<Vec3fa> vertices0;           //!< fast access to first vertex buffer
     Device::vector<BufferView<Vec3fa>> vertices = device; //!< vertex array for each timestep
     Device::vector<RawBufferView> vertexAttribs = device; //!< vertex attribute buffers
+    AlphaMask alphaMask = device;                         //!< built-in alpha mask
   };
 
   namespace isa
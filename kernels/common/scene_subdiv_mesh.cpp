@@ -33,6 +33,9 @@ namespace embree
     : Geometry(device,GTY_SUBDIV_MESH,0,1), 
       displFunc(nullptr),
       tessellationRate(2.0f),
+      tessellationCamera(zero),
+      tessellationCameraRate(0.0f),
+      maxDisplacement(0.0f),
       numHalfEdges(0),
       faceStartEdge(device,0),
       halfEdgeFace(device,0),
@@ -365,6 +368,22 @@ namespace embree
     Geometry::update();
   }
 
+  void SubdivMesh::updateBufferRange(RTCBufferType type, unsigned int slot, size_t first, size_t count)
+  {
+    /* only index buffer updates are processed incrementally */
+    if (type != RTC_BUFFER_TYPE_INDEX)
+      return updateBuffer(type,slot);
+
+    if (slot >= topology.size())
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid buffer slot");
+    if (first > topology[slot].vertexIndices.size() || count > topology[slot].vertexIndices.size()-first)
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid buffer range");
+
+    commitCounter++;
+    modifiedIndexRanges.push_back(range<size_t>(first,first+count));
+    Geometry::update();
+  }
+
   void SubdivMesh::setDisplacementFunction (RTCDisplacementFunctionN func) 
   {
     this->displFunc = func;
@@ -376,6 +395,43 @@ namespace embree
     levels.setModified();
   }
 
+  void SubdivMesh::setTessellationCamera(const Vec3fa& P, float rate)
+  {
+    tessellationCamera = P;
+    tessellationCameraRate = rate;
+    levels.setModified();
+  }
+
+  void SubdivMesh::setMaxDisplacement(float maxDisplacement)
+  {
+    if (!(maxDisplacement >= 0.0f))
+      throw_RTCError(RTC_ERROR_INVALID_ARGUMENT, "invalid maximal displacement");
+
+    this->maxDisplacement = maxDisplacement;
+    levels.setModified();
+  }
+
+  float SubdivMesh::getAdaptiveEdgeLevel(const size_t i) const
+  {
+    /* we always use the geometry topology to get the edge vertices */
+    const unsigned int f = halfEdgeFace[i];
+    const size_t next = i+1 == faceStartEdge[f]+faceVertices[f] ? faceStartEdge[f] : i+1;
+    const unsigned int v0 = topology[0].vertexIndices[i];
+    const unsigned int v1 = topology[0].vertexIndices[next];
+    if (v0 >= numVertices() || v1 >= numVertices())
+      return 1.0f;
+
+    /* the displaced edge lies inside a sphere around the edge center,
+     * that can get at most maxDisplacement closer to the camera */
+    const Vec3fa p0 = vertices[0][v0];
+    const Vec3fa p1 = vertices[0][v1];
+    const float radius = 0.5f*length(p1-p0) + maxDisplacement;
+    const float dist = max(length(tessellationCamera-0.5f*(p0+p1)) - maxDisplacement, 1E-6f);
+    const float level = tessellationCameraRate*radius/dist;
+    if (!(level >= 1.0f)) return 1.0f; // also handles NaN
+    return min(level,4096.0f);
+  }
+
   __forceinline uint64_t pair64(unsigned int x, unsigned int y) 
   {
     if (x<y) std::swap(x,y);
@@ -417,6 +473,116 @@ namespace embree
     return true;
   }
 
+  void SubdivMesh::Topology::initializeFaceHalfEdges(size_t f, KeyHalfEdge* keys)
+  {
+    const unsigned N = mesh->faceVertices[f];
+    const unsigned e = mesh->faceStartEdge[f];
+
+    for (unsigned de=0; de<N; de++)
+    {
+      HalfEdge* edge = &halfEdges[e+de];
+      int nextOfs = (de == (N-1)) ? -int(N-1) : +1;
+      int prevOfs = (de ==     0) ? +int(N-1) : -1;
+      
+      const unsigned int startVertex = vertexIndices[e+de];
+      const unsigned int endVertex = vertexIndices[e+de+nextOfs]; 
+      const uint64_t key = SubdivMesh::Edge(startVertex,endVertex);
+
+      /* we always have to use the geometry topology to lookup creases */
+      const unsigned int startVertex0 = mesh->topology[0].vertexIndices[e+de];
+      const unsigned int endVertex0 = mesh->topology[0].vertexIndices[e+de+nextOfs]; 
+      const uint64_t key0 = SubdivMesh::Edge(startVertex0,endVertex0);
+      
+      edge->vtx_index              = startVertex;
+      edge->next_half_edge_ofs     = nextOfs;
+      edge->prev_half_edge_ofs     = prevOfs;
+      edge->opposite_half_edge_ofs = 0;
+      edge->edge_crease_weight     = mesh->edgeCreaseMap->edgeCreaseMap.lookup(key0,0.0f);
+      edge->vertex_crease_weight   = mesh->vertexCreaseMap->vertexCreaseMap.lookup(startVertex0,0.0f);
+      edge->edge_level             = mesh->getEdgeLevel(e+de);
+      edge->patch_type             = HalfEdge::COMPLEX_PATCH; // type gets updated below
+      edge->vertex_type            = HalfEdge::REGULAR_VERTEX;
+
+      if (unlikely(mesh->holeSet->holeSet.lookup(unsigned(f)))) 
+        keys[de] = SubdivMesh::KeyHalfEdge(std::numeric_limits<uint64_t>::max(),edge);
+      else
+        keys[de] = SubdivMesh::KeyHalfEdge(key,edge);
+    }
+  }
+
+  void SubdivMesh::Topology::linkAdjacentHalfEdges(KeyHalfEdge* edges, size_t N)
+  {
+    /* border edges are identified by not having an opposite edge set */
+    if (N == 1) {
+      edges[0].edge->edge_crease_weight = float(inf);
+    }
+
+    /* standard edge shared between two faces */
+    else if (N == 2)
+    {
+      /* create edge crease if winding order mismatches between neighboring patches */
+      if (edges[0].edge->next()->vtx_index != edges[1].edge->vtx_index)
+      {
+        edges[0].edge->edge_crease_weight = float(inf);
+        edges[1].edge->edge_crease_weight = float(inf);
+      }
+      /* otherwise mark edges as opposites of each other */
+      else {
+        edges[0].edge->setOpposite(edges[1].edge);
+        edges[1].edge->setOpposite(edges[0].edge);
+      }
+    }
+
+    /* non-manifold geometry is handled by keeping vertices fixed during subdivision */
+    else {
+      for (size_t i=0; i<N; i++) {
+        edges[i].edge->vertex_crease_weight = inf;
+        edges[i].edge->vertex_type = HalfEdge::NON_MANIFOLD_EDGE_VERTEX;
+        edges[i].edge->edge_crease_weight = inf;
+
+        edges[i].edge->next()->vertex_crease_weight = inf;
+        edges[i].edge->next()->vertex_type = HalfEdge::NON_MANIFOLD_EDGE_VERTEX;
+        edges[i].edge->next()->edge_crease_weight = inf;
+      }
+    }
+  }
+
+  void SubdivMesh::Topology::finalizeFaceHalfEdges(size_t f)
+  {
+    HalfEdge* edge = &halfEdges[mesh->faceStartEdge[f]];
+
+    /* for vertex topology we also test if vertices are valid */
+    if (this == &mesh->topology[0])
+    {
+      /* calculate if face is valid */
+      for (size_t t=0; t<mesh->numTimeSteps; t++)
+        mesh->invalidFace(f,t) = !edge->valid(mesh->vertices[t]) || mesh->holeSet->holeSet.lookup(unsigned(f));
+    }
+
+    /* pin some edges and vertices */
+    for (size_t i=0; i<mesh->faceVertices[f]; i++) 
+    {
+      /* pin corner vertices when requested by user */
+      if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_CORNERS && edge[i].isCorner())
+        edge[i].vertex_crease_weight = float(inf);
+      
+      /* pin all border vertices when requested by user */
+      else if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_BOUNDARY && edge[i].vertexHasBorder()) 
+        edge[i].vertex_crease_weight = float(inf);
+
+      /* pin all edges and vertices when requested by user */
+      else if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_ALL) {
+        edge[i].edge_crease_weight = float(inf);
+        edge[i].vertex_crease_weight = float(inf);
+      }
+    }
+
+    /* we have to calculate patch_type last! */
+    HalfEdge::PatchType patch_type = edge->patchType();
+    for (size_t i=0; i<mesh->faceVertices[f]; i++) 
+      edge[i].patch_type = patch_type;
+  }
+
   void SubdivMesh::Topology::calculateHalfEdges()
   {
     const size_t blockSize = 4096;
@@ -427,46 +593,13 @@ namespace embree
     /* allocate temporary array */
     halfEdges0.resize(numEdges);
     halfEdges1.resize(numEdges);
+    halfEdges2.clear();
 
     /* create all half edges */
     parallel_for( size_t(0), numFaces, blockSize, [&](const range<size_t>& r) 
     {
       for (size_t f=r.begin(); f<r.end(); f++) 
-      {
-	const unsigned N = mesh->faceVertices[f];
-	const unsigned e = mesh->faceStartEdge[f];
-
-	for (unsigned de=0; de<N; de++)
-	{
-	  HalfEdge* edge = &halfEdges[e+de];
-          int nextOfs = (de == (N-1)) ? -int(N-1) : +1;
-          int prevOfs = (de ==     0) ? +int(N-1) : -1;
-	  
-	  const unsigned int startVertex = vertexIndices[e+de];
-          const unsigned int endVertex = vertexIndices[e+de+nextOfs]; 
-	  const uint64_t key = SubdivMesh::Edge(startVertex,endVertex);
-
-          /* we always have to use the geometry topology to lookup creases */
-          const unsigned int startVertex0 = mesh->topology[0].vertexIndices[e+de];
-          const unsigned int endVertex0 = mesh->topology[0].vertexIndices[e+de+nextOfs]; 
-	  const uint64_t key0 = SubdivMesh::Edge(startVertex0,endVertex0);
-	  
-	  edge->vtx_index              = startVertex;
-	  edge->next_half_edge_ofs     = nextOfs;
-	  edge->prev_half_edge_ofs     = prevOfs;
-	  edge->opposite_half_edge_ofs = 0;
-	  edge->edge_crease_weight     = mesh->edgeCreaseMap->edgeCreaseMap.lookup(key0,0.0f);
-	  edge->vertex_crease_weight   = mesh->vertexCreaseMap->vertexCreaseMap.lookup(startVertex0,0.0f);
-	  edge->edge_level             = mesh->getEdgeLevel(e+de);
-          edge->patch_type             = HalfEdge::COMPLEX_PATCH; // type gets updated below
-          edge->vertex_type            = HalfEdge::REGULAR_VERTEX;
-
-          if (unlikely(mesh->holeSet->holeSet.lookup(unsigned(f)))) 
-	    halfEdges1[e+de] = SubdivMesh::KeyHalfEdge(std::numeric_limits<uint64_t>::max(),edge);
-	  else
-	    halfEdges1[e+de] = SubdivMesh::KeyHalfEdge(key,edge);
-	}
-      }
+        initializeFaceHalfEdges(f,&halfEdges1[mesh->faceStartEdge[f]]);
     });
 
     /* sort half edges to find adjacent edges */
@@ -488,40 +621,7 @@ namespace embree
 	const uint64_t key = halfEdges1[e].key;
 	if (key == std::numeric_limits<uint64_t>::max()) break;
 	size_t N=1; while (e+N<numHalfEdges && halfEdges1[e+N].key == key) N++;
-
-        /* border edges are identified by not having an opposite edge set */
-	if (N == 1) {
-          halfEdges1[e].edge->edge_crease_weight = float(inf);
-	}
-
-        /* standard edge shared between two faces */
-        else if (N == 2)
-        {
-          /* create edge crease if winding order mismatches between neighboring patches */
-          if (halfEdges1[e+0].edge->next()->vtx_index != halfEdges1[e+1].edge->vtx_index)
-          {
-            halfEdges1[e+0].edge->edge_crease_weight = float(inf);
-            halfEdges1[e+1].edge->edge_crease_weight = float(inf);
-          }
-          /* otherwise mark edges as opposites of each other */
-          else {
-            halfEdges1[e+0].edge->setOpposite(halfEdges1[e+1].edge);
-            halfEdges1[e+1].edge->setOpposite(halfEdges1[e+0].edge);
-          }
-	}
-
-        /* non-manifold geometry is handled by keeping vertices fixed during subdivision */
-        else {
-	  for (size_t i=0; i<N; i++) {
-	    halfEdges1[e+i].edge->vertex_crease_weight = inf;
-            halfEdges1[e+i].edge->vertex_type = HalfEdge::NON_MANIFOLD_EDGE_VERTEX;
-            halfEdges1[e+i].edge->edge_crease_weight = inf;
-
-	    halfEdges1[e+i].edge->next()->vertex_crease_weight = inf;
-            halfEdges1[e+i].edge->next()->vertex_type = HalfEdge::NON_MANIFOLD_EDGE_VERTEX;
-            halfEdges1[e+i].edge->next()->edge_crease_weight = inf;
-	  }
-	}
+        linkAdjacentHalfEdges(&halfEdges1[e],N);
 	e+=N;
       }
     });
@@ -530,41 +630,153 @@ namespace embree
     parallel_for( size_t(0), numFaces, blockSize, [&](const range<size_t>& r) 
     {
       for (size_t f=r.begin(); f<r.end(); f++) 
-      {
-        HalfEdge* edge = &halfEdges[mesh->faceStartEdge[f]];
+        finalizeFaceHalfEdges(f);
+    });
+  }
+
+  template<typename T>
+  static void sort_unique(std::vector<T>& v)
+  {
+    std::sort(v.begin(),v.end());
+    v.erase(std::unique(v.begin(),v.end()),v.end());
+  }
+
+  bool SubdivMesh::Topology::updateHalfEdgesIncremental(const std::vector<unsigned int>& modifiedFaces)
+  {
+    const size_t numHalfEdges = mesh->numHalfEdges;
+
+    /* the sorted half edges of the last recalculation are required to find adjacent edges */
+    if (halfEdges1.size() < numHalfEdges)
+      return false;
+
+    /* large modifications are processed faster by recalculating all half edges */
+    size_t numModifiedEdges = 0;
+    for (unsigned int f : modifiedFaces) numModifiedEdges += mesh->faceVertices[f];
+    if (halfEdges2.size()+numModifiedEdges > max(size_t(1024),numHalfEdges/16))
+      return false;
 
-        /* for vertex topology we also test if vertices are valid */
-        if (this == &mesh->topology[0])
+    auto faceOf = [&] (const HalfEdge* edge) -> unsigned int {
+      return mesh->halfEdgeFace[edge-halfEdges.data()];
+    };
+
+    /* sorted entries get stale when the key of their half edge changes */
+    auto currentKey = [&] (const HalfEdge* edge) -> uint64_t {
+      if (unlikely(mesh->holeSet->holeSet.lookup(faceOf(edge)))) return std::numeric_limits<uint64_t>::max();
+      return SubdivMesh::Edge(edge->getStartVertexIndex(),edge->getEndVertexIndex());
+    };
+
+    /* finds all half edges with some key in both sorted arrays */
+    std::vector<KeyHalfEdge> adjacent;
+    auto findAdjacentHalfEdges = [&] (uint64_t key)
+    {
+      adjacent.clear();
+      auto find = [&] (const KeyHalfEdge* begin, const KeyHalfEdge* end)
+      {
+        for (const KeyHalfEdge* i=std::lower_bound(begin,end,KeyHalfEdge(key,nullptr)); i!=end && i->key == key; i++)
         {
-          /* calculate if face is valid */
-          for (size_t t=0; t<mesh->numTimeSteps; t++)
-            mesh->invalidFace(f,t) = !edge->valid(mesh->vertices[t]) || mesh->holeSet->holeSet.lookup(unsigned(f));
+          if (currentKey(i->edge) != key) continue;
+          bool found = false;
+          for (const KeyHalfEdge& k : adjacent) found |= k.edge == i->edge;
+          if (!found) adjacent.push_back(*i);
         }
+      };
+      find(halfEdges1.data(),halfEdges1.data()+numHalfEdges);
+      find(halfEdges2.data(),halfEdges2.data()+halfEdges2.size());
+    };
+
+    /* reinitializes the half edges of some faces and links them with all adjacent half edges */
+    std::vector<KeyHalfEdge> keys;
+    auto relinkFaces = [&] (const std::vector<unsigned int>& faces)
+    {
+      keys.clear();
+      for (unsigned int f : faces) {
+        const size_t i = keys.size();
+        keys.resize(i+mesh->faceVertices[f]);
+        initializeFaceHalfEdges(f,&keys[i]);
+      }
+      std::vector<uint64_t> edgeKeys;
+      for (const KeyHalfEdge& k : keys)
+        if (k.key != std::numeric_limits<uint64_t>::max()) edgeKeys.push_back(k.key);
+      sort_unique(edgeKeys);
+      for (uint64_t key : edgeKeys) {
+        findAdjacentHalfEdges(key);
+        linkAdjacentHalfEdges(adjacent.data(),adjacent.size());
+      }
+    };
+
+    /* keys of the modified faces before the modification */
+    std::vector<uint64_t> modifiedKeys;
+    for (unsigned int f : modifiedFaces) {
+      const HalfEdge* edge = &halfEdges[mesh->faceStartEdge[f]];
+      for (size_t i=0; i<mesh->faceVertices[f]; i++)
+        modifiedKeys.push_back(currentKey(&edge[i]));
+    }
 
-        /* pin some edges and vertices */
-        for (size_t i=0; i<mesh->faceVertices[f]; i++) 
-        {
-          /* pin corner vertices when requested by user */
-          if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_CORNERS && edge[i].isCorner())
-            edge[i].vertex_crease_weight = float(inf);
-          
-          /* pin all border vertices when requested by user */
-          else if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_BOUNDARY && edge[i].vertexHasBorder()) 
-            edge[i].vertex_crease_weight = float(inf);
+    /* add the modified half edges with their new keys to the second sorted array */
+    keys.clear();
+    for (unsigned int f : modifiedFaces) {
+      const size_t i = keys.size();
+      keys.resize(i+mesh->faceVertices[f]);
+      initializeFaceHalfEdges(f,&keys[i]);
+    }
+    for (const KeyHalfEdge& k : keys)
+      modifiedKeys.push_back(k.key);
+    for (const KeyHalfEdge& k : halfEdges2)
+      if (currentKey(k.edge) == k.key) keys.push_back(k);
+    std::sort(keys.begin(),keys.end(),[] (const KeyHalfEdge& a, const KeyHalfEdge& b) {
+        return a.key < b.key || (a.key == b.key && a.edge < b.edge);
+      });
+    keys.erase(std::unique(keys.begin(),keys.end(),[] (const KeyHalfEdge& a, const KeyHalfEdge& b) {
+          return a.key == b.key && a.edge == b.edge;
+        }),keys.end());
+    while (keys.size() && keys.back().key == std::numeric_limits<uint64_t>::max()) keys.pop_back();
+    halfEdges2 = keys;
+    sort_unique(modifiedKeys);
+
+    /* all faces sharing an old or new edge with a modified face get relinked */
+    std::vector<unsigned int> faces(modifiedFaces);
+    for (uint64_t key : modifiedKeys) {
+      if (key == std::numeric_limits<uint64_t>::max()) continue;
+      findAdjacentHalfEdges(key);
+      for (const KeyHalfEdge& k : adjacent) faces.push_back(faceOf(k.edge));
+    }
+    sort_unique(faces);
+    relinkFaces(faces);
 
-          /* pin all edges and vertices when requested by user */
-          else if (subdiv_mode == RTC_SUBDIVISION_MODE_PIN_ALL) {
-            edge[i].edge_crease_weight = float(inf);
-            edge[i].vertex_crease_weight = float(inf);
+    /* vertex pinning and patch types depend on the 1-ring of all vertices of the relinked faces */
+    std::vector<unsigned int> ring;
+    for (unsigned int f : faces)
+    {
+      const HalfEdge* h = &halfEdges[mesh->faceStartEdge[f]];
+      for (size_t i=0; i<mesh->faceVertices[f]; i++)
+      {
+        const HalfEdge* p = &h[i];
+        bool border = false;
+        do {
+          ring.push_back(faceOf(p));
+          if (!p->hasOpposite()) { border = true; break; }
+          p = p->rotate();
+        } while (p != &h[i]);
+
+        /* go the other direction around border vertices */
+        if (border) {
+          for (p = h[i].prev(); p->hasOpposite(); p = p->prev()) {
+            p = p->opposite();
+            ring.push_back(faceOf(p));
           }
         }
-
-        /* we have to calculate patch_type last! */
-        HalfEdge::PatchType patch_type = edge->patchType();
-        for (size_t i=0; i<mesh->faceVertices[f]; i++) 
-          edge[i].patch_type = patch_type;
       }
-    });
+    }
+    sort_unique(ring);
+
+    std::vector<unsigned int> neighbors;
+    std::set_difference(ring.begin(),ring.end(),faces.begin(),faces.end(),std::back_inserter(neighbors));
+    relinkFaces(neighbors);
+
+    for (unsigned int f : ring)
+      finalizeFaceHalfEdges(f);
+
+    return true;
   }
 
   void SubdivMesh::Topology::updateHalfEdges()
@@ -572,14 +784,13 @@ namespace embree
     /* we always use the geometry topology to lookup creases */
     mvector<HalfEdge>& halfEdgesGeom = mesh->topology[0].halfEdges;
 
-    /* assume we do no longer recalculate in the future and clear these arrays */
+    /* the sorted half edges are kept for incremental topology updates */
     halfEdges0.clear();
-    halfEdges1.clear();
 
     /* calculate which data to update */
     const bool updateEdgeCreases   = mesh->topology[0].vertexIndices.isLocalModified() || mesh->edge_creases.isLocalModified()   || mesh->edge_crease_weights.isLocalModified();
     const bool updateVertexCreases = mesh->topology[0].vertexIndices.isLocalModified() || mesh->vertex_creases.isLocalModified() || mesh->vertex_crease_weights.isLocalModified(); 
-    const bool updateLevels = mesh->levels.isLocalModified();
+    const bool updateLevels = mesh->levels.isLocalModified() || (mesh->adaptiveTessellation() && mesh->vertices[0].isLocalModified());
 
     /* parallel loop over all half edges */
     parallel_for( size_t(0), mesh->numHalfEdges, size_t(4096), [&](const range<size_t>& r) 
@@ -624,7 +835,7 @@ namespace embree
     });
   }
 
-  void SubdivMesh::Topology::initializeHalfEdgeStructures ()
+  void SubdivMesh::Topology::initializeHalfEdgeStructures (const std::vector<unsigned int>& modifiedFaces)
   {
     /* if vertex indices not set we ignore this topology */
     if (!vertexIndices)
@@ -647,6 +858,11 @@ namespace embree
     update |= mesh->vertex_creases.isLocalModified();
     update |= mesh->vertex_crease_weights.isLocalModified(); 
     update |= mesh->levels.isLocalModified();
+    update |= mesh->adaptiveTessellation() && mesh->vertices[0].isLocalModified(); // adaptive edge levels depend on the vertex positions
+
+    /* small modifications of the index buffer get processed incrementally */
+    if (!recalculate && modifiedFaces.size())
+      recalculate = !updateHalfEdgesIncremental(modifiedFaces);
 
     /* now either recalculate or update the half edges */
     if (recalculate) calculateHalfEdges();
@@ -720,9 +936,22 @@ namespace embree
     if (holes.isLocalModified())
       holeSet->holeSet.init(holes);
 
+    /* faces modified through ranged index buffer updates */
+    std::vector<unsigned int> modifiedFaces;
+    if (!faceVertices.isLocalModified())
+    {
+      for (const range<size_t>& r : modifiedIndexRanges)
+        for (size_t e=r.begin(); e<min(r.end(),numHalfEdges); e++)
+          if (modifiedFaces.empty() || modifiedFaces.back() != halfEdgeFace[e])
+            modifiedFaces.push_back(halfEdgeFace[e]);
+      std::sort(modifiedFaces.begin(),modifiedFaces.end());
+      modifiedFaces.erase(std::unique(modifiedFaces.begin(),modifiedFaces.end()),modifiedFaces.end());
+    }
+    modifiedIndexRanges.clear();
+
     /* create topology */
     for (auto& t: topology)
-      t.initializeHalfEdgeStructures();
+      t.initializeHalfEdgeStructures(modifiedFaces);
 
     /* create interpolation cache mapping for interpolatable meshes */
     for (size_t i=0; i<vertex_buffer_tags.size(); i++)
@@ -953,34 +1182,145 @@ namespace embree
       }
       
       const int* valid = (const int*) valid_i;
-      
-      for (size_t i=0; i<N; i+=4) 
+
+      /* large query sets are processed in windows, windows with incoherent queries get evaluated patch by patch */
+      const size_t windowSize = N >= 4*VSIZEX ? size_t(4096) : size_t(N);
+      for (size_t w=0; w<N; w+=windowSize)
       {
-        vbool4 valid1 = vint4(int(i))+vint4(step) < vint4(int(N));
-        if (valid) valid1 &= vint4::loadu(&valid[i]) == vint4(-1);
-        if (none(valid1)) continue;
+        const size_t end = min(w+windowSize,size_t(N));
+        if (N >= 4*VSIZEX && interpolateBatched(args,src,stride,*baseEntry,*topo,w,end))
+          continue;
         
-        const vuint4 primID = vuint4::loadu(&primIDs[i]);
-        const vfloat4 uu = vfloat4::loadu(&u[i]);
-        const vfloat4 vv = vfloat4::loadu(&v[i]);
+        for (size_t i=w; i<end; i+=4) 
+        {
+          vbool4 valid1 = vint4(int(i))+vint4(step) < vint4(int(N));
+          if (valid) valid1 &= vint4::loadu(&valid[i]) == vint4(-1);
+          if (none(valid1)) continue;
+        
+          const vuint4 primID = vuint4::loadu(&primIDs[i]);
+          const vfloat4 uu = vfloat4::loadu(&u[i]);
+          const vfloat4 vv = vfloat4::loadu(&v[i]);
         
-        foreach_unique(valid1,primID,[&](const vbool4& valid1, const unsigned int primID)
-                       {
-                         for (unsigned int j=0; j<valueCount; j+=4) 
+          foreach_unique(valid1,primID,[&](const vbool4& valid1, const unsigned int primID)
                          {
-                           const size_t M = min(4u,valueCount-j);
-                           isa::PatchEvalSimd<vbool4,vint4,vfloat4,vfloat4>(baseEntry->at(interpolationSlot(primID,j/4,stride)),commitCounter,
-                                                                            topo->getHalfEdge(primID),src+j*sizeof(float),stride,valid1,uu,vv,
-                                                                            P ? P+j*N+i : nullptr,
-                                                                            dPdu ? dPdu+j*N+i : nullptr,
-                                                                            dPdv ? dPdv+j*N+i : nullptr,
-                                                                            ddPdudu ? ddPdudu+j*N+i : nullptr,
-                                                                            ddPdvdv ? ddPdvdv+j*N+i : nullptr,
-                                                                            ddPdudv ? ddPdudv+j*N+i : nullptr,
-                                                                            N,M);
-                         }
-                       });
+                           for (unsigned int j=0; j<valueCount; j+=4) 
+                           {
+                             const size_t M = min(4u,valueCount-j);
+                             isa::PatchEvalSimd<vbool4,vint4,vfloat4,vfloat4>(baseEntry->at(interpolationSlot(primID,j/4,stride)),commitCounter,
+                                                                              topo->getHalfEdge(primID),src+j*sizeof(float),stride,valid1,uu,vv,
+                                                                              P ? P+j*N+i : nullptr,
+                                                                              dPdu ? dPdu+j*N+i : nullptr,
+                                                                              dPdv ? dPdv+j*N+i : nullptr,
+                                                                              ddPdudu ? ddPdudu+j*N+i : nullptr,
+                                                                              ddPdvdv ? ddPdvdv+j*N+i : nullptr,
+                                                                              ddPdudv ? ddPdudv+j*N+i : nullptr,
+                                                                              N,M);
+                           }
+                         });
+        }
+      }
+    }
+
+    /*! interpolation query sorted by primitive and u/v location */
+    struct __aligned(8) InterpolationQuery
+    {
+      unsigned int code;     //!< lower primitive ID bits and morton code of u/v location
+      unsigned int index;    //!< i'th query
+
+      /*! interface for radix sort */
+      __forceinline operator unsigned() const { return code; }
+
+      /*! interface for standard sort */
+      __forceinline bool operator<(const InterpolationQuery& q) const { return code < q.code; }
+    };
+
+    bool SubdivMeshISA::interpolateBatched(const RTCInterpolateNArguments* const args, const char* src, size_t stride,
+                                           std::vector<SharedLazyTessellationCache::CacheEntry>& baseEntry, const Topology& topo,
+                                           size_t begin, size_t end)
+    {
+      const int* valid = (const int*) args->valid;
+      const unsigned* primIDs = args->primIDs;
+      const float* u = args->u;
+      const float* v = args->v;
+      const size_t N = args->N;
+      float* dst[6] = { args->P, args->dPdu, args->dPdv, args->ddPdudu, args->ddPdvdv, args->ddPdudv };
+      const unsigned int valueCount = args->valueCount;
+
+      /* count how often the primitive changes between consecutive active queries and
+       * estimate the number of different primitives using a small hashed bit set */
+      uint64_t primSet[64] = { 0 };
+      size_t numQueries = 0, numRuns = 0, numPrims = 0;
+      unsigned int lastPrimID = 0;
+      for (size_t i=begin; i<end; i++) {
+        if (valid && valid[i] != -1) continue;
+        const unsigned int primID = primIDs[i];
+        numRuns += numQueries == 0 || lastPrimID != primID;
+        const uint64_t bit = uint64_t(1) << (primID & 63);
+        numPrims += (primSet[(primID >> 6) & 63] & bit) == 0;
+        primSet[(primID >> 6) & 63] |= bit;
+        lastPrimID = primID;
+        numQueries++;
+      }
+
+      /* coherent queries already fill the SIMD lanes when processed in order, and sorting
+       * does not pay off when most primitives get queried only a few times */
+      if (numRuns*VSIZEX <= numQueries || 4*numPrims > numQueries)
+        return false;
+
+      std::vector<InterpolationQuery> queries(numQueries);
+      for (size_t i=begin, n=0; i<end; i++) {
+        if (valid && valid[i] != -1) continue;
+        const unsigned int cu = unsigned(clamp(u[i],0.0f,1.0f)*15.0f);
+        const unsigned int cv = unsigned(clamp(v[i],0.0f,1.0f)*15.0f);
+        queries[n].code = (primIDs[i] << 12) | bitInterleave(cu,cv,0u);
+        queries[n].index = unsigned(i);
+        n++;
+      }
+
+      /* incoherent queries get sorted by primitive and then by a morton code of their
+       * u/v location, such that nearby queries of a patch share SIMD chunks and thus
+       * mostly traverse the same sub patches */
+      radixsort32(queries.data(),numQueries);
+
+      typedef vector_t<float,aligned_allocator<float,64>> aligned_floats;
+      const size_t dstride = (numQueries+VSIZEX-1) & ~size_t(VSIZEX-1);
+      aligned_floats uu(dstride), vv(dstride);
+      aligned_floats buf[6];
+      float* out[6];
+      for (size_t k=0; k<6; k++) {
+        if (dst[k]) buf[k].resize(4*dstride);
+        out[k] = dst[k] ? buf[k].data() : nullptr;
+      }
+
+      /* all queries of a patch get evaluated together with full SIMD width */
+      for (size_t b=0, e=0; b<numQueries; b=e)
+      {
+        const unsigned int primID = primIDs[queries[b].index];
+        for (e=b+1; e<numQueries && primIDs[queries[e].index] == primID; e++);
+        const size_t M = e-b;
+        const size_t Mpad = (M+VSIZEX-1) & ~size_t(VSIZEX-1);
+        for (size_t q=0; q<Mpad; q++) {
+          const size_t i = queries[b+min(q,M-1)].index;
+          uu[q] = u[i]; vv[q] = v[i];
+        }
+
+        for (unsigned int j=0; j<valueCount; j+=4) 
+        {
+          const size_t K = min(4u,valueCount-j);
+          isa::PatchEvalSimd<vboolx,vintx,vfloatx,vfloat4>(baseEntry[interpolationSlot(primID,j/4,stride)],commitCounter,
+                                                           topo.getHalfEdge(primID),src+j*sizeof(float),stride,uu.data(),vv.data(),M,
+                                                           out[0],out[1],out[2],out[3],out[4],out[5],
+                                                           dstride,K);
+          
+          for (size_t k=0; k<6; k++) {
+            if (!dst[k]) continue;
+            for (size_t c=0; c<K; c++)
+              for (size_t q=0; q<M; q++)
+                dst[k][(j+c)*N+queries[b+q].index] = out[k][c*dstride+q];
+          }
+        }
       }
+      return true;
     }
   }
 }
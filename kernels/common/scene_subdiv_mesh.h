@@ -63,7 +63,10 @@ namespace embree
     void setBuffer(RTCBufferType type, unsigned int slot, RTCFormat format, const Ref<Buffer>& buffer, size_t offset, size_t stride, unsigned int num);
     void* getBuffer(RTCBufferType type, unsigned int slot);
     void updateBuffer(RTCBufferType type, unsigned int slot);
+    void updateBufferRange(RTCBufferType type, unsigned int slot, size_t first, size_t count);
     void setTessellationRate(float N);
+    void setTessellationCamera(const Vec3fa& P, float rate);
+    void setMaxDisplacement(float maxDisplacement);
     bool verify();
     void commit();
     void addElementsToCount (GeometryCounts & counts) const;
@@ -123,9 +126,18 @@ namespace embree
     __forceinline float getEdgeLevel(const size_t i) const
     {
       if (levels) return clamp(levels[i],1.0f,4096.0f); // FIXME: do we want to limit edge level?
+      else if (adaptiveTessellation()) return getAdaptiveEdgeLevel(i);
       else return clamp(tessellationRate,1.0f,4096.0f); // FIXME: do we want to limit edge level?
     }
 
+    /* checks if edge levels get calculated from the tessellation camera */
+    __forceinline bool adaptiveTessellation() const {
+      return !levels && tessellationCameraRate > 0.0f;
+    }
+
+    /* calculates the edge level from the distance to the tessellation camera */
+    float getAdaptiveEdgeLevel(const size_t i) const;
+
   public:
     RTCDisplacementFunctionN displFunc;    //!< displacement function
 
@@ -152,7 +164,8 @@ namespace embree
           subdiv_mode(std::move(other.subdiv_mode)),
           halfEdges(std::move(other.halfEdges)),
           halfEdges0(std::move(other.halfEdges0)),
-          halfEdges1(std::move(other.halfEdges1)) {}
+          halfEdges1(std::move(other.halfEdges1)),
+          halfEdges2(std::move(other.halfEdges2)) {}
       
       Topology& operator= (Topology&& other) // FIXME: this is only required to workaround compilation issues under Windows
       {
@@ -162,6 +175,7 @@ namespace embree
         halfEdges = std::move(other.halfEdges);
         halfEdges0 = std::move(other.halfEdges0);
         halfEdges1 = std::move(other.halfEdges1);
+        halfEdges2 = std::move(other.halfEdges2);
         return *this;
       }
 
@@ -184,8 +198,8 @@ namespace embree
       /*! verifies index array */
       bool verify (size_t numVertices);
 
-      /*! initializes the half edge data structure */
-      void initializeHalfEdgeStructures ();
+      /*! initializes the half edge data structure, modifiedFaces lists the faces changed through ranged index buffer updates */
+      void initializeHalfEdgeStructures (const std::vector<unsigned int>& modifiedFaces);
 
     private:
       
@@ -194,6 +208,18 @@ namespace embree
       
       /*! updates half edges when recalculation is not necessary */
       void updateHalfEdges();
+
+      /*! relinks the half edges of modified faces and their neighborhood, returns false if full recalculation is required */
+      bool updateHalfEdgesIncremental(const std::vector<unsigned int>& modifiedFaces);
+
+      /*! initializes the half edges of face f and stores their sort keys */
+      void initializeFaceHalfEdges(size_t f, KeyHalfEdge* keys);
+
+      /*! links N half edges sharing the same key */
+      static void linkAdjacentHalfEdges(KeyHalfEdge* edges, size_t N);
+
+      /*! pins vertices and edges of face f and calculates its patch type */
+      void finalizeFaceHalfEdges(size_t f);
       
       /*! user input data */
     public:
@@ -224,6 +250,9 @@ namespace embree
       /*! two arrays used to sort the half edges */
       std::vector<KeyHalfEdge> halfEdges0;
       std::vector<KeyHalfEdge> halfEdges1;
+
+      /*! sorted keys of half edges modified since the last recalculation, entries of halfEdges1 get stale for these */
+      std::vector<KeyHalfEdge> halfEdges2;
     };
 
     /*! returns the start half edge for topology t and face f */
@@ -258,6 +287,9 @@ namespace embree
     /*! subdivision level for each half edge of the vertexIndices buffer */
     BufferView<float> levels;
     float tessellationRate;  // constant rate that is used when levels is not set
+    Vec3fa tessellationCamera;    // camera position for adaptive edge levels
+    float tessellationCameraRate; // edge level per unit of edge size divided by distance, adaptive edge levels are disabled when <= 0
+    float maxDisplacement;   // user provided bound of the displacement, 0 when unknown
 
     /*! buffer that marks specific faces as holes */
     BufferView<unsigned> holes;
@@ -274,6 +306,9 @@ namespace embree
     /*! fast lookup table to find the face for some half edge */
     mvector<uint32_t> halfEdgeFace;
 
+    /*! ranges of index buffer items modified through rtcUpdateGeometryBufferRange since the last commit */
+    std::vector<range<size_t>> modifiedIndexRanges;
+
     /*! set with all holes */
     std::unique_ptr<HoleSet> holeSet;
 
@@ -296,6 +331,9 @@ namespace embree
     std::vector<std::vector<SharedLazyTessellationCache::CacheEntry>> vertex_buffer_tags;
     std::vector<std::vector<SharedLazyTessellationCache::CacheEntry>> vertex_attrib_buffer_tags;
     std::vector<Patch3fa::Ref> patch_eval_trees;
+
+    /*! returns the number of geometry commits, used to validate cached tessellations */
+    __forceinline size_t getCommitCounter() const { return commitCounter; }
     
     /*! the following data is only required during construction of the
      *  half edge structure and can be cleared for static scenes */
@@ -322,6 +360,12 @@ namespace embree
 
       void interpolate(const RTCInterpolateArguments* const args);
       void interpolateN(const RTCInterpolateNArguments* const args);
+
+    private:
+      /* evaluates the queries begin to end patch by patch, returns false if the queries are coherent enough to get evaluated in order */
+      bool interpolateBatched(const RTCInterpolateNArguments* const args, const char* src, size_t stride,
+                              std::vector<SharedLazyTessellationCache::CacheEntry>& baseEntry, const Topology& topo,
+                              size_t begin, size_t end);
     };
   }
 
@@ -134,6 +134,13 @@ namespace embree
     Geometry::update();
   }
 
+  void TriangleMesh::setAlphaMask (RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff)
+  {
+    alphaMask.set(format,texels,width,height,uvSlot,cutoff);
+    alphaMaskEnabled = alphaMask.enabled();
+    Geometry::update();
+  }
+
   void TriangleMesh::commit()
   {
     /* verify that stride of all time steps are identical */
@@ -141,6 +148,8 @@ namespace embree
       if (vertices[t].getStride() != vertices[0].getStride())
         throw_RTCError(RTC_ERROR_INVALID_OPERATION,"stride of vertex buffers have to be identical for each time step");
 
+    alphaMask.verifyTexcoords(vertexAttribs);
+
     Geometry::commit();
   }
 
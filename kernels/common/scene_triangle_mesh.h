@@ -5,6 +5,7 @@
 
 #include "geometry.h"
 #include "buffer.h"
+#include "alpha_mask.h"
 
 namespace embree
 {
@@ -38,6 +39,7 @@ namespace embree
     void setBuffer(RTCBufferType type, unsigned int slot, RTCFormat format, const Ref<Buffer>& buffer, size_t offset, size_t stride, unsigned int num);
     void* getBuffer(RTCBufferType type, unsigned int slot);
     void updateBuffer(RTCBufferType type, unsigned int slot);
+    void setAlphaMask (RTCAlphaMaskFormat format, const void* texels, unsigned int width, unsigned int height, unsigned int uvSlot, float cutoff);
     void commit();
     bool verify();
     void interpolate(const RTCInterpolateArguments* const args);
@@ -269,11 +271,19 @@ namespace embree
       return areaProjectedTriangle(v0,v1,v2);
     }
 
+    /*! tests the alpha mask at the hit location u/v of the i'th triangle */
+    __forceinline bool alphaMaskOpaque(size_t i, float u, float v) const
+    {
+      const Triangle& tri = triangle(i);
+      return alphaMask.opaque(vertexAttribs[alphaMask.uvSlot],tri.v[0],tri.v[1],tri.v[2],u,v);
+    }
+
   public:
     BufferView<Triangle> triangles;      //!< array of triangles
     BufferView<Vec3fa> vertices0;        //!< fast access to first vertex buffer
     Device::vector<BufferView<Vec3fa>> vertices = device; //!< vertex array for each timestep
     Device::vector<RawBufferView> vertexAttribs = device; //!< vertex attributes
+    AlphaMask alphaMask = device;                         //!< built-in alpha mask
   };
 
   namespace isa
@@ -34,6 +34,14 @@ namespace embree
   void UserGeometry::setOccludedFunctionN (RTCOccludedFunctionN occluded) {
     intersectorN.occluded = occluded;
   }
+
+  void UserGeometry::setIntersectFunctionBatch (RTCIntersectFunctionBatch intersect) {
+    intersectorN.intersectBatch = intersect;
+  }
+
+  void UserGeometry::setOccludedFunctionBatch (RTCOccludedFunctionBatch occluded) {
+    intersectorN.occludedBatch = occluded;
+  }
   
 #endif
 
@@ -10,6 +10,7 @@
 #include "curve_intersector_ribbon.h"
 #include "curve_intersector_oriented.h"
 #include "curve_intersector_sweep.h"
+#include "curve_intersector_lod.h"
 
 namespace embree
 {
@@ -75,6 +76,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff a0,a1,a2,a3; geom->gather(a0,a1,a2,a3,geom->curve(primID));
 
           size_t mask1 = mask;
@@ -109,6 +112,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff a0,a1,a2,a3; geom->gather(a0,a1,a2,a3,geom->curve(primID));
          
           size_t mask1 = mask;
@@ -131,6 +136,95 @@ namespace embree
         return false;
       }
 
+      /* intersects as many candidate curves of the leaf at once as the
+       * intersector can pack into its SIMD lanes */
+      template<typename Intersector, typename Epilog>
+        static __forceinline void intersect_p(const Precalculations& pre, RayHit& ray, RayQueryContext* context, const Primitive& prim)
+      {
+        vfloat<M> tNear;
+        vbool<M> valid = intersect(ray,prim,tNear);
+
+        const size_t N = prim.N;
+        size_t mask = movemask(valid);
+        if (!mask) return;
+
+        const unsigned int geomID = prim.geomID(N);
+        const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+        const size_t maxCurves = min(size_t(M),Intersector::maxPackedCurves(geom));
+        CurveLODRange1 lod(ray,geom);
+
+        while (mask)
+        {
+          unsigned int primIDs[M];
+          Vec3ff a0[M],a1[M],a2[M],a3[M];
+          size_t numCurves = 0;
+          while (mask && numCurves < maxCurves)
+          {
+            const size_t i = bscf(mask);
+            STAT3(normal.trav_prims,1,1,1);
+            if (lod.cull(tNear[i])) continue;
+            primIDs[numCurves] = prim.primID(N)[i];
+            geom->gather(a0[numCurves],a1[numCurves],a2[numCurves],a3[numCurves],geom->curve(primIDs[numCurves]));
+            numCurves++;
+          }
+          if (numCurves == 0) break;
+
+          if (mask) {
+            const unsigned int primID1 = prim.primID(N)[bsf(mask)];
+            geom->prefetchL1_vertices(geom->curve(primID1));
+          }
+
+          Intersector().intersect_packed(pre,ray,context,geom,numCurves,a0,a1,a2,a3,
+                                         [&] (size_t c) { return Epilog(ray,context,geomID,primIDs[c]); });
+          mask &= movemask(tNear <= vfloat<M>(ray.tfar));
+        }
+      }
+
+      template<typename Intersector, typename Epilog>
+        static __forceinline bool occluded_p(const Precalculations& pre, Ray& ray, RayQueryContext* context, const Primitive& prim)
+      {
+        vfloat<M> tNear;
+        vbool<M> valid = intersect(ray,prim,tNear);
+
+        const size_t N = prim.N;
+        size_t mask = movemask(valid);
+        if (!mask) return false;
+
+        const unsigned int geomID = prim.geomID(N);
+        const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+        const size_t maxCurves = min(size_t(M),Intersector::maxPackedCurves(geom));
+        CurveLODRange1 lod(ray,geom);
+
+        while (mask)
+        {
+          unsigned int primIDs[M];
+          Vec3ff a0[M],a1[M],a2[M],a3[M];
+          size_t numCurves = 0;
+          while (mask && numCurves < maxCurves)
+          {
+            const size_t i = bscf(mask);
+            STAT3(shadow.trav_prims,1,1,1);
+            if (lod.cull(tNear[i])) continue;
+            primIDs[numCurves] = prim.primID(N)[i];
+            geom->gather(a0[numCurves],a1[numCurves],a2[numCurves],a3[numCurves],geom->curve(primIDs[numCurves]));
+            numCurves++;
+          }
+          if (numCurves == 0) break;
+
+          if (mask) {
+            const unsigned int primID1 = prim.primID(N)[bsf(mask)];
+            geom->prefetchL1_vertices(geom->curve(primID1));
+          }
+
+          if (Intersector().intersect_packed(pre,ray,context,geom,numCurves,a0,a1,a2,a3,
+                                             [&] (size_t c) { return Epilog(ray,context,geomID,primIDs[c]); }))
+            return true;
+
+          mask &= movemask(tNear <= vfloat<M>(ray.tfar));
+        }
+        return false;
+      }
+
       template<typename Intersector, typename Epilog>
         static __forceinline void intersect_n(const Precalculations& pre, RayHit& ray, RayQueryContext* context, const Primitive& prim)
       {
@@ -146,6 +240,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           
           unsigned int vertexID = geom->curve(primID);
           Vec3ff a0,a1,a2,a3; Vec3fa n0,n1,n2,n3; geom->gather(a0,a1,a2,a3,n0,n1,n2,n3,vertexID);
@@ -182,6 +278,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
 
           unsigned int vertexID = geom->curve(primID);
           Vec3ff a0,a1,a2,a3; Vec3fa n0,n1,n2,n3; geom->gather(a0,a1,a2,a3,n0,n1,n2,n3,vertexID);
@@ -221,6 +319,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; geom->gather_hermite(p0,t0,p1,t1,geom->curve(primID));
           Intersector().intersect(pre,ray,context,geom,primID,p0,t0,p1,t1,Epilog(ray,context,geomID,primID));
           mask &= movemask(tNear <= vfloat<M>(ray.tfar));
@@ -242,6 +342,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; geom->gather_hermite(p0,t0,p1,t1,geom->curve(primID));
           if (Intersector().intersect(pre,ray,context,geom,primID,p0,t0,p1,t1,Epilog(ray,context,geomID,primID)))
             return true;
@@ -266,6 +368,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; Vec3fa n0,dn0,n1,dn1; geom->gather_hermite(p0,t0,n0,dn0,p1,t1,n1,dn1,geom->curve(primID));
           Intersector().intersect(pre,ray,context,geom,primID,p0,t0,p1,t1,n0,dn0,n1,dn1,Epilog(ray,context,geomID,primID));
           mask &= movemask(tNear <= vfloat<M>(ray.tfar));
@@ -287,6 +391,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; Vec3fa n0,dn0,n1,dn1; geom->gather_hermite(p0,t0,n0,dn0,p1,t1,n1,dn1,geom->curve(primID));
           if (Intersector().intersect(pre,ray,context,geom,primID,p0,t0,p1,t1,n0,dn0,n1,dn1,Epilog(ray,context,geomID,primID)))
             return true;
@@ -359,6 +465,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff a0,a1,a2,a3; geom->gather(a0,a1,a2,a3,geom->curve(primID));
 
           size_t mask1 = mask;
@@ -393,6 +501,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff a0,a1,a2,a3; geom->gather(a0,a1,a2,a3,geom->curve(primID));
 
           size_t mask1 = mask;
@@ -430,6 +540,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
 
           unsigned int vertexID = geom->curve(primID);
           Vec3ff a0,a1,a2,a3; Vec3fa n0,n1,n2,n3; geom->gather(a0,a1,a2,a3,n0,n1,n2,n3,vertexID);
@@ -466,6 +578,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
 
           unsigned int vertexID = geom->curve(primID);
           Vec3ff a0,a1,a2,a3; Vec3fa n0,n1,n2,n3; geom->gather(a0,a1,a2,a3,n0,n1,n2,n3,vertexID);
@@ -505,6 +619,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; geom->gather_hermite(p0,t0,p1,t1,geom->curve(primID));
           Intersector().intersect(pre,ray,k,context,geom,primID,p0,t0,p1,t1,Epilog(ray,k,context,geomID,primID));
           mask &= movemask(tNear <= vfloat<M>(ray.tfar[k]));
@@ -526,6 +642,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; geom->gather_hermite(p0,t0,p1,t1,geom->curve(primID));
           if (Intersector().intersect(pre,ray,k,context,geom,primID,p0,t0,p1,t1,Epilog(ray,k,context,geomID,primID)))
             return true;
@@ -550,6 +668,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; Vec3fa n0,dn0,n1,dn1; geom->gather_hermite(p0,t0,n0,dn0,p1,t1,n1,dn1,geom->curve(primID));
           Intersector().intersect(pre,ray,k,context,geom,primID,p0,t0,p1,t1,n0,dn0,n1,dn1,Epilog(ray,k,context,geomID,primID));
           mask &= movemask(tNear <= vfloat<M>(ray.tfar[k]));
@@ -571,6 +691,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = context->scene->get<CurveGeometry>(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           Vec3ff p0,t0,p1,t1; Vec3fa n0,dn0,n1,dn1; geom->gather_hermite(p0,t0,n0,dn0,p1,t1,n1,dn1,geom->curve(primID));
           if (Intersector().intersect(pre,ray,k,context,geom,primID,p0,t0,p1,t1,n0,dn0,n1,dn1,Epilog(ray,k,context,geomID,primID)))
             return true;
@@ -31,6 +31,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = (CurveGeometry*) context->scene->get(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           const Vec3ff a0 = Vec3ff::loadu(&prim.vertices(i,N)[0]);
           const Vec3ff a1 = Vec3ff::loadu(&prim.vertices(i,N)[1]);
           const Vec3ff a2 = Vec3ff::loadu(&prim.vertices(i,N)[2]);
@@ -68,6 +70,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = (CurveGeometry*) context->scene->get(geomID);
+          CurveLODRange1 lod(ray,geom);
+          if (lod.cull(tNear[i])) continue;
           const Vec3ff a0 = Vec3ff::loadu(&prim.vertices(i,N)[0]);
           const Vec3ff a1 = Vec3ff::loadu(&prim.vertices(i,N)[1]);
           const Vec3ff a2 = Vec3ff::loadu(&prim.vertices(i,N)[2]);
@@ -115,6 +119,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = (CurveGeometry*) context->scene->get(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           const Vec3ff a0 = Vec3ff::loadu(&prim.vertices(i,N)[0]);
           const Vec3ff a1 = Vec3ff::loadu(&prim.vertices(i,N)[1]);
           const Vec3ff a2 = Vec3ff::loadu(&prim.vertices(i,N)[2]);
@@ -152,6 +158,8 @@ namespace embree
           const unsigned int geomID = prim.geomID(N);
           const unsigned int primID = prim.primID(N)[i];
           const CurveGeometry* geom = (CurveGeometry*) context->scene->get(geomID);
+          CurveLODRangeK<K> lod(ray,k,geom);
+          if (lod.cull(tNear[i])) continue;
           const Vec3ff a0 = Vec3ff::loadu(&prim.vertices(i,N)[0]);
           const Vec3ff a1 = Vec3ff::loadu(&prim.vertices(i,N)[1]);
           const Vec3ff a2 = Vec3ff::loadu(&prim.vertices(i,N)[2]);
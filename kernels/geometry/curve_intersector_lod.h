@@ -0,0 +1,82 @@
+// Copyright 2009-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../common/ray.h"
+#include "../common/scene_curves.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /* Restricts the ray interval to the distance range in which the
+     * curve geometry is visible while a curve of that geometry gets
+     * intersected. The original interval is restored at the end of the
+     * scope, except for tfar when a hit was found inside the range. */
+    struct CurveLODRange1
+    {
+      __forceinline CurveLODRange1(Ray& ray, const CurveGeometry* geom)
+        : ray(ray), active(geom->hasLODRange())
+      {
+        if (likely(!active)) return;
+        tnear = ray.tnear();
+        tfar = ray.tfar;
+        const float rcp_length = rsqrt(dot(ray.dir,ray.dir));
+        ray.tnear() = max(tnear,geom->lodRange.lower*rcp_length);
+        ray.tfar = tfar_lod = min(tfar,geom->lodRange.upper*rcp_length);
+      }
+
+      __forceinline ~CurveLODRange1()
+      {
+        if (likely(!active)) return;
+        ray.tnear() = tnear;
+        if (ray.tfar == tfar_lod) ray.tfar = tfar;
+      }
+
+      /* culls curves whose bounds start behind the visible range */
+      __forceinline bool cull(float tNear) const {
+        return active && (tNear > ray.tfar || ray.tnear() > ray.tfar);
+      }
+
+    private:
+      Ray& ray;
+      bool active;
+      float tnear, tfar, tfar_lod;
+    };
+
+    template<int K>
+    struct CurveLODRangeK
+    {
+      __forceinline CurveLODRangeK(RayK<K>& ray, size_t k, const CurveGeometry* geom)
+        : ray(ray), k(k), active(geom->hasLODRange())
+      {
+        if (likely(!active)) return;
+        tnear = ray.tnear()[k];
+        tfar = ray.tfar[k];
+        const Vec3fa ray_dir(ray.dir.x[k],ray.dir.y[k],ray.dir.z[k]);
+        const float rcp_length = rsqrt(dot(ray_dir,ray_dir));
+        ray.tnear()[k] = max(tnear,geom->lodRange.lower*rcp_length);
+        ray.tfar[k] = tfar_lod = min(tfar,geom->lodRange.upper*rcp_length);
+      }
+
+      __forceinline ~CurveLODRangeK()
+      {
+        if (likely(!active)) return;
+        ray.tnear()[k] = tnear;
+        if (ray.tfar[k] == tfar_lod) ray.tfar[k] = tfar;
+      }
+
+      /* culls curves whose bounds start behind the visible range */
+      __forceinline bool cull(float tNear) const {
+        return active && (tNear > ray.tfar[k] || ray.tnear()[k] > ray.tfar[k]);
+      }
+
+    private:
+      RayK<K>& ray;
+      size_t k;
+      bool active;
+      float tnear, tfar, tfar_lod;
+    };
+  }
+}
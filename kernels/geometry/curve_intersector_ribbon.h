@@ -175,7 +175,81 @@ namespace embree
       }
       return ishit;
     }
-        
+
+    /* intersects several curves at once, each curve occupying N
+     * consecutive SIMD lanes, which keeps the SIMD units busy for
+     * tessellation rates smaller than the SIMD width */
+    template<template<typename Ty> class NativeCurve, int M = VSIZEX, typename Epilogs>
+    __forceinline bool intersect_ribbon_packed(const Vec3fa& ray_org, const float ray_tnear, const float& ray_tfar,
+                                               const LinearSpace3fa& ray_space, const float& depth_scale,
+                                               const NativeCurve<Vec3ff>* curves3D, const int numCurves, const int N,
+                                               const Epilogs& epilogs)
+    {
+      assert(numCurves*N <= M);
+
+      /* transform control points into ray space and distribute the curves over the lanes */
+      const Vec4vf<M> v_zero(zero);
+      NativeCurve<Vec4vf<M>> curve2D(v_zero,v_zero,v_zero,v_zero);
+      vint<M> first(zero);
+      vfloat<M> eps(zero);
+      for (int c=0; c<numCurves; c++)
+      {
+        const NativeCurve<Vec3ff> curve = curves3D[c].xfm_pr(ray_space,ray_org);
+        const vbool<M> lanes = (vint<M>(step) >= vint<M>(c*N)) & (vint<M>(step) < vint<M>((c+1)*N));
+        curve2D.v0 = select(lanes,Vec4vf<M>(curve.v0),curve2D.v0);
+        curve2D.v1 = select(lanes,Vec4vf<M>(curve.v1),curve2D.v1);
+        curve2D.v2 = select(lanes,Vec4vf<M>(curve.v2),curve2D.v2);
+        curve2D.v3 = select(lanes,Vec4vf<M>(curve.v3),curve2D.v3);
+        first = select(lanes,vint<M>(c*N),first);
+        eps = select(lanes,vfloat<M>(4.0f*float(ulp)*reduce_max(max(abs(curve.v0),abs(curve.v1),abs(curve.v2),abs(curve.v3)))),eps);
+      }
+
+      /* evaluate the curves */
+      vbool<M> valid = vint<M>(step) < vint<M>(numCurves*N);
+      const vint<M> j = vint<M>(step)-first;
+      const vfloat<M> t0 = vfloat<M>(j)/vfloat<M>(float(N));
+      const vfloat<M> t1 = vfloat<M>(j+1)/vfloat<M>(float(N));
+      const Vec4vf<M> p0 = curve2D.template veval<M>(t0);
+      const Vec4vf<M> p1 = curve2D.template veval<M>(t1);
+      valid &= cylinder_culling_test<M>(zero,Vec2vf<M>(p0.x,p0.y),Vec2vf<M>(p1.x,p1.y),max(p0.w,p1.w));
+      if (none(valid)) return false;
+
+      Vec3vf<M> dp0dt = curve2D.template veval_du<M>(t0);
+      Vec3vf<M> dp1dt = curve2D.template veval_du<M>(t1);
+      dp0dt = select(reduce_max(abs(dp0dt)) < eps,Vec3vf<M>(p1-p0),dp0dt);
+      dp1dt = select(reduce_max(abs(dp1dt)) < eps,Vec3vf<M>(p1-p0),dp1dt);
+      const Vec3vf<M> n0(dp0dt.y,-dp0dt.x,0.0f);
+      const Vec3vf<M> n1(dp1dt.y,-dp1dt.x,0.0f);
+      const Vec3vf<M> nn0 = normalize(n0);
+      const Vec3vf<M> nn1 = normalize(n1);
+      const Vec3vf<M> lp0 = madd(p0.w,nn0,Vec3vf<M>(p0));
+      const Vec3vf<M> lp1 = madd(p1.w,nn1,Vec3vf<M>(p1));
+      const Vec3vf<M> up0 = nmadd(p0.w,nn0,Vec3vf<M>(p0));
+      const Vec3vf<M> up1 = nmadd(p1.w,nn1,Vec3vf<M>(p1));
+
+      vfloat<M> vu,vv,vt;
+      vbool<M> valid0 = intersect_quad_backface_culling<M>(valid,zero,Vec3fa(0,0,1),ray_tnear,ray_tfar,lp0,lp1,up1,up0,vu,vv,vt);
+      if (none(valid0)) return false;
+
+      /* ignore self intersections */
+      if (EMBREE_CURVE_SELF_INTERSECTION_AVOIDANCE_FACTOR != 0.0f) {
+        vfloat<M> r = lerp(p0.w, p1.w, vu);
+        valid0 &= vt > float(EMBREE_CURVE_SELF_INTERSECTION_AVOIDANCE_FACTOR)*r*depth_scale;
+      }
+      vv = madd(2.0f,vv,vfloat<M>(-1.0f));
+
+      /* report the hits curve by curve, hits behind an already found hit get skipped */
+      bool ishit = false;
+      for (int c=0; c<numCurves; c++)
+      {
+        const vbool<M> valid1 = valid0 & (first == vint<M>(c*N)) & (vt <= vfloat<M>(ray_tfar));
+        if (none(valid1)) continue;
+        RibbonHit<NativeCurve<Vec3ff>,M> bhit(valid1,vu,vv,vt,-c*N,N,curves3D[c]);
+        ishit |= epilogs(c)(bhit.valid,bhit);
+      }
+      return ishit;
+    }
+
     template<template<typename Ty> class NativeCurve, int M = VSIZEX>
     struct RibbonCurve1Intersector1
     {
@@ -196,6 +270,36 @@ namespace embree
                                                 curve,N,
                                                 epilog);
       }
+
+      /* number of curves of the geometry that fit into the SIMD lanes */
+      static __forceinline size_t maxPackedCurves(const CurveGeometry* geom) {
+        return max(size_t(1),size_t(M/geom->tessellationRate));
+      }
+
+      template<typename Ray, typename Epilogs>
+      __forceinline bool intersect_packed(const CurvePrecalculations1& pre, Ray& ray,
+                                          RayQueryContext* context,
+                                          const CurveGeometry* geom, const size_t numCurves,
+                                          const Vec3ff* v0, const Vec3ff* v1, const Vec3ff* v2, const Vec3ff* v3,
+                                          const Epilogs& epilogs)
+      {
+        assert(numCurves <= maxPackedCurves(geom));
+        const int N = geom->tessellationRate;
+        NativeCurve3ff curves[M];
+        for (size_t c=0; c<numCurves; c++)
+          curves[c] = enlargeRadiusToMinWidth(context,geom,ray.org,NativeCurve3ff(v0[c],v1[c],v2[c],v3[c]));
+
+        if (numCurves == 1)
+          return intersect_ribbon<M,NativeCurve3ff>(ray.org,ray.dir,ray.tnear(),ray.tfar,
+                                                  pre.ray_space,pre.depth_scale,
+                                                  curves[0],N,
+                                                  epilogs(0));
+
+        return intersect_ribbon_packed<NativeCurve,M>(ray.org,ray.tnear(),ray.tfar,
+                                                      pre.ray_space,pre.depth_scale,
+                                                      curves,int(numCurves),N,
+                                                      epilogs);
+      }
     };
     
     template<template<typename Ty> class NativeCurve, int K, int M = VSIZEX>
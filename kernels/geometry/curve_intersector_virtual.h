@@ -49,6 +49,8 @@ namespace embree
     typedef void (*Intersect16Ty)(void* pre, void* ray, size_t k, RayQueryContext* context, const void* primitive);
     typedef bool (*Occluded16Ty) (void* pre, void* ray, size_t k, RayQueryContext* context, const void* primitive);
 
+    typedef bool (*PointQuery1Ty)(PointQuery* query, PointQueryContext* context, const void* primitive);
+
   public:
     struct Intersectors
     {
@@ -69,6 +71,7 @@ namespace embree
       Occluded8Ty  occluded8;
       Intersect16Ty intersect16;
       Occluded16Ty  occluded16;
+      PointQuery1Ty pointQuery1; //!< only set for point geometry types
     };
     
     Intersectors vtbl[Geometry::GTY_END];
@@ -116,6 +119,21 @@ namespace embree
         VirtualCurveIntersector::Intersectors& leafIntersector = ((VirtualCurveIntersector*) This->leafIntersector)->vtbl[ty];
         return leafIntersector.occluded<1>(&pre,&ray,context,prim);
       }
+
+      template<int N>
+        static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context, const Primitive* prim, size_t num, const TravPointQuery<N> &tquery, size_t& lazy_node)
+      {
+        assert(num == 1);
+        Geometry::GType ty = (Geometry::GType)(*prim);
+
+        /* point queries are only supported for point geometries */
+        if (ty != Geometry::GTY_SPHERE_POINT && ty != Geometry::GTY_DISC_POINT && ty != Geometry::GTY_ORIENTED_DISC_POINT)
+          return false;
+        
+        assert(This->leafIntersector);
+        VirtualCurveIntersector::Intersectors& leafIntersector = ((VirtualCurveIntersector*) This->leafIntersector)->vtbl[ty];
+        return leafIntersector.pointQuery1(query,context,prim);
+      }
     };
 
     template<int K>
@@ -294,6 +312,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &SphereMiIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &SphereMiIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &SphereMiIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &SphereMiIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &SphereMiIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -313,6 +332,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &SphereMiMBIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &SphereMiMBIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &SphereMiMBIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &SphereMiMBIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &SphereMiMBIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -332,6 +352,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &DiscMiIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &DiscMiIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &DiscMiIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &DiscMiIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &DiscMiIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -351,6 +372,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &DiscMiMBIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &DiscMiMBIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &DiscMiMBIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &DiscMiMBIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &DiscMiMBIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -370,6 +392,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &OrientedDiscMiIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &OrientedDiscMiIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &OrientedDiscMiIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &OrientedDiscMiIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &OrientedDiscMiIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -389,6 +412,7 @@ namespace embree
       VirtualCurveIntersector::Intersectors intersectors;
       intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &OrientedDiscMiMBIntersector1<N,true>::intersect;
       intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &OrientedDiscMiMBIntersector1<N,true>::occluded;
+      intersectors.pointQuery1 = (VirtualCurveIntersector::PointQuery1Ty) &OrientedDiscMiMBIntersector1<N,true>::pointQuery;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &OrientedDiscMiMBIntersectorK<N,4,true>::intersect;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &OrientedDiscMiMBIntersectorK<N,4,true>::occluded;
 #if defined(__AVX__)
@@ -406,8 +430,8 @@ namespace embree
       static VirtualCurveIntersector::Intersectors RibbonNiIntersectors()
     {
       VirtualCurveIntersector::Intersectors intersectors;
-      intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &CurveNiIntersector1<N>::template intersect_t<RibbonCurve1Intersector1<Curve>, Intersect1EpilogMU<VSIZEX,true> >;
-      intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &CurveNiIntersector1<N>::template occluded_t <RibbonCurve1Intersector1<Curve>, Occluded1EpilogMU<VSIZEX,true> >;
+      intersectors.intersect1 = (VirtualCurveIntersector::Intersect1Ty) &CurveNiIntersector1<N>::template intersect_p<RibbonCurve1Intersector1<Curve>, Intersect1EpilogMU<VSIZEX,true> >;
+      intersectors.occluded1  = (VirtualCurveIntersector::Occluded1Ty)  &CurveNiIntersector1<N>::template occluded_p <RibbonCurve1Intersector1<Curve>, Occluded1EpilogMU<VSIZEX,true> >;
       intersectors.intersect4 = (VirtualCurveIntersector::Intersect4Ty) &CurveNiIntersectorK<N,4>::template intersect_t<RibbonCurve1IntersectorK<Curve,4>, Intersect1KEpilogMU<VSIZEX,4,true> >;
       intersectors.occluded4  = (VirtualCurveIntersector::Occluded4Ty)  &CurveNiIntersectorK<N,4>::template occluded_t <RibbonCurve1IntersectorK<Curve,4>, Occluded1KEpilogMU<VSIZEX,4,true> >;
 #if defined(__AVX__)
@@ -42,6 +42,13 @@ namespace embree
         return DiscIntersector1<M>::intersect(
           valid, ray, context, geom, pre, v0, Occluded1EpilogM<M, filter>(ray, context, Disc.geomID(), Disc.primID()));
       }
+
+      static __forceinline bool pointQuery(PointQuery* query,
+                                           PointQueryContext* context,
+                                           const Primitive& Disc)
+      {
+        return PrimitivePointQuery1<Primitive>::pointQuery(query, context, Disc);
+      }
     };
 
     template<int M, bool filter>
@@ -75,6 +82,13 @@ namespace embree
         return DiscIntersector1<M>::intersect(
           valid, ray, context, geom, pre, v0, Occluded1EpilogM<M, filter>(ray, context, Disc.geomID(), Disc.primID()));
       }
+
+      static __forceinline bool pointQuery(PointQuery* query,
+                                           PointQueryContext* context,
+                                           const Primitive& Disc)
+      {
+        return PrimitivePointQuery1<Primitive>::pointQuery(query, context, Disc);
+      }
     };
 
     template<int M, int K, bool filter>
@@ -171,6 +185,13 @@ namespace embree
         return DiscIntersector1<M>::intersect(
           valid, ray, context, geom, pre, v0, n0, Occluded1EpilogM<M, filter>(ray, context, Disc.geomID(), Disc.primID()));
       }
+
+      static __forceinline bool pointQuery(PointQuery* query,
+                                           PointQueryContext* context,
+                                           const Primitive& Disc)
+      {
+        return PrimitivePointQuery1<Primitive>::pointQuery(query, context, Disc);
+      }
     };
 
     template<int M, bool filter>
@@ -206,6 +227,13 @@ namespace embree
         return DiscIntersector1<M>::intersect(
           valid, ray, context, geom, pre, v0, n0, Occluded1EpilogM<M, filter>(ray, context, Disc.geomID(), Disc.primID()));
       }
+
+      static __forceinline bool pointQuery(PointQuery* query,
+                                           PointQueryContext* context,
+                                           const Primitive& Disc)
+      {
+        return PrimitivePointQuery1<Primitive>::pointQuery(query, context, Disc);
+      }
     };
 
     template<int M, int K, bool filter>
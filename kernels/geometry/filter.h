@@ -4,6 +4,8 @@
 #pragma once
 
 #include "../common/geometry.h"
+#include "../common/scene_triangle_mesh.h"
+#include "../common/scene_quad_mesh.h"
 #include "../common/ray.h"
 #include "../common/hit.h"
 #include "../common/context.h"
@@ -12,6 +14,32 @@ namespace embree
 {
   namespace isa
   {
+    /*! evaluates the built-in alpha mask of triangle and quad meshes */
+    __forceinline bool runAlphaMask1(const Geometry* const geometry, unsigned int primID, float u, float v)
+    {
+      if (likely(!geometry->hasAlphaMask()))
+        return true;
+
+      if (geometry->getType() == Geometry::GTY_TRIANGLE_MESH)
+        return ((const TriangleMesh*)geometry)->alphaMaskOpaque(primID,u,v);
+      else
+        return ((const QuadMesh*)geometry)->alphaMaskOpaque(primID,u,v);
+    }
+
+    template<int K>
+    __forceinline vbool<K> runAlphaMask(const vbool<K>& valid, const Geometry* const geometry, const HitK<K>& hit)
+    {
+      if (likely(!geometry->hasAlphaMask()))
+        return valid;
+
+      vbool<K> valid_o = valid;
+      for (size_t k=0; k<K; k++) {
+        if (valid[k] && !runAlphaMask1(geometry,hit.primID[k],hit.u[k],hit.v[k]))
+          clear(valid_o,k);
+      }
+      return valid_o;
+    }
+
     __forceinline bool runIntersectionFilter1Helper(RTCFilterFunctionNArguments* args, const Geometry* const geometry, RayQueryContext* context)
     {
       if (geometry->intersectionFilterN)
@@ -37,6 +65,9 @@ namespace embree
     
     __forceinline bool runIntersectionFilter1(const Geometry* const geometry, RayHit& ray, RayQueryContext* context, Hit& hit)
     {
+      if (!runAlphaMask1(geometry,hit.primID,hit.u,hit.v))
+        return false;
+
       RTCFilterFunctionNArguments args;
       int mask = -1;
       args.valid = &mask;
@@ -72,6 +103,9 @@ namespace embree
 
     __forceinline bool runOcclusionFilter1(const Geometry* const geometry, Ray& ray, RayQueryContext* context, Hit& hit)
     {
+      if (!runAlphaMask1(geometry,hit.primID,hit.u,hit.v))
+        return false;
+
       RTCFilterFunctionNArguments args;
       int mask = -1;
       args.valid = &mask;
@@ -106,8 +140,11 @@ namespace embree
     }
     
     template<int K>
-    __forceinline vbool<K> runIntersectionFilter(const vbool<K>& valid, const Geometry* const geometry, RayHitK<K>& ray, RayQueryContext* context, HitK<K>& hit)
+    __forceinline vbool<K> runIntersectionFilter(const vbool<K>& valid_i, const Geometry* const geometry, RayHitK<K>& ray, RayQueryContext* context, HitK<K>& hit)
     {
+      const vbool<K> valid = runAlphaMask<K>(valid_i,geometry,hit);
+      if (none(valid)) return valid;
+
       RTCFilterFunctionNArguments args;
       vint<K> mask = valid.mask32();
       args.valid = (int*)&mask;
@@ -141,8 +178,11 @@ namespace embree
     }
 
     template<int K>
-      __forceinline vbool<K> runOcclusionFilter(const vbool<K>& valid, const Geometry* const geometry, RayK<K>& ray, RayQueryContext* context, HitK<K>& hit)
+      __forceinline vbool<K> runOcclusionFilter(const vbool<K>& valid_i, const Geometry* const geometry, RayK<K>& ray, RayQueryContext* context, HitK<K>& hit)
     {
+      const vbool<K> valid = runAlphaMask<K>(valid_i,geometry,hit);
+      if (none(valid)) return valid;
+
       RTCFilterFunctionNArguments args;
       vint<K> mask = valid.mask32();
       args.valid = (int*)&mask;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "object.h"
+#include "intersector_iterators.h"
 #include "../common/ray.h"
 
 namespace embree
@@ -150,6 +151,171 @@ namespace embree
       }
     };
 
+    /*! Gathers the primIDs of consecutive leaf primitives of the same geometry. */
+    __forceinline size_t gatherObjectBatch(const Object* prim, size_t begin, size_t num, unsigned int* primIDs, size_t maxBatchSize)
+    {
+      const unsigned int geomID = prim[begin].geomID();
+      size_t n = 0;
+      for (size_t i=begin; i<num && n<maxBatchSize && prim[i].geomID() == geomID; i++)
+        primIDs[n++] = prim[i].primID();
+      return n;
+    }
+
+    /*! Leaf intersector for single rays that invokes the batched
+     *  callbacks of user geometries once for all primitives of a leaf */
+    template<bool mblur>
+    struct ObjectArrayIntersector1 : public ArrayIntersector1<ObjectIntersector1<mblur>>
+    {
+      typedef ObjectIntersector1<mblur> Intersector;
+      typedef typename Intersector::Primitive Primitive;
+      typedef typename Intersector::Precalculations Precalculations;
+
+      static const size_t maxBatchSize = BVH4::maxLeafBlocks;
+
+      template<int N, bool robust>
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHit& ray, RayQueryContext* context, const Primitive* prim, size_t num, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        for (size_t i=0; i<num;)
+        {
+          const unsigned int geomID = prim[i].geomID();
+          AccelSet* accel = (AccelSet*) context->scene->get(geomID);
+          if (!accel->hasIntersectFunctionBatch(context)) {
+            Intersector::intersect(pre,ray,context,prim[i++]);
+            continue;
+          }
+
+          unsigned int primIDs[maxBatchSize];
+          const size_t n = gatherObjectBatch(prim,i,num,primIDs,maxBatchSize);
+          i += n;
+
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          if ((ray.mask & accel->mask) == 0)
+            continue;
+#endif
+          accel->intersectBatch(ray,geomID,primIDs,(unsigned int)n,context);
+        }
+      }
+
+      template<int N, bool robust>
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, Ray& ray, RayQueryContext* context, const Primitive* prim, size_t num, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        for (size_t i=0; i<num;)
+        {
+          const unsigned int geomID = prim[i].geomID();
+          AccelSet* accel = (AccelSet*) context->scene->get(geomID);
+          if (!accel->hasOccludedFunctionBatch(context)) {
+            if (Intersector::occluded(pre,ray,context,prim[i++]))
+              return true;
+            continue;
+          }
+
+          unsigned int primIDs[maxBatchSize];
+          const size_t n = gatherObjectBatch(prim,i,num,primIDs,maxBatchSize);
+          i += n;
+
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          if ((ray.mask & accel->mask) == 0)
+            continue;
+#endif
+          accel->occludedBatch(ray,geomID,primIDs,(unsigned int)n,context);
+          if (ray.tfar < 0.0f)
+            return true;
+        }
+        return false;
+      }
+    };
+
+    /*! Leaf intersector for ray packets that invokes the batched
+     *  callbacks of user geometries once for all primitives of a leaf */
+    template<int K, bool mblur>
+    struct ObjectArrayIntersectorK_1 : public ArrayIntersectorK_1<K,ObjectIntersectorK<K,mblur>>
+    {
+      typedef ObjectIntersectorK<K,mblur> Intersector;
+      typedef typename Intersector::Primitive Primitive;
+      typedef typename Intersector::Precalculations Precalculations;
+
+      static const size_t maxBatchSize = BVH4::maxLeafBlocks;
+
+      static __forceinline void intersectLeaf(const vbool<K>& valid_i, Precalculations& pre, RayHitK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t num)
+      {
+        for (size_t i=0; i<num;)
+        {
+          const unsigned int geomID = prim[i].geomID();
+          AccelSet* accel = (AccelSet*) context->scene->get(geomID);
+          if (!accel->hasIntersectFunctionBatch(context)) {
+            Intersector::intersect(valid_i,pre,ray,context,prim[i++]);
+            continue;
+          }
+
+          unsigned int primIDs[maxBatchSize];
+          const size_t n = gatherObjectBatch(prim,i,num,primIDs,maxBatchSize);
+          i += n;
+
+          vbool<K> valid = valid_i;
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          valid &= (ray.mask & accel->mask) != 0;
+          if (none(valid)) continue;
+#endif
+          accel->intersectBatch(valid,ray,geomID,primIDs,(unsigned int)n,context);
+        }
+      }
+
+      static __forceinline vbool<K> occludedLeaf(const vbool<K>& valid, Precalculations& pre, RayK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t num)
+      {
+        vbool<K> valid0 = valid;
+        for (size_t i=0; i<num;)
+        {
+          const unsigned int geomID = prim[i].geomID();
+          AccelSet* accel = (AccelSet*) context->scene->get(geomID);
+          if (!accel->hasOccludedFunctionBatch(context)) {
+            valid0 &= !Intersector::occluded(valid0,pre,ray,context,prim[i++]);
+            if (none(valid0)) break;
+            continue;
+          }
+
+          unsigned int primIDs[maxBatchSize];
+          const size_t n = gatherObjectBatch(prim,i,num,primIDs,maxBatchSize);
+          i += n;
+
+          vbool<K> valid1 = valid0;
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          valid1 &= (ray.mask & accel->mask) != 0;
+          if (none(valid1)) continue;
+#endif
+          accel->occludedBatch(valid1,ray,geomID,primIDs,(unsigned int)n,context);
+          valid0 &= !(ray.tfar < 0.0f);
+          if (none(valid0)) break;
+        }
+        return !valid0;
+      }
+
+      template<bool robust>
+      static __forceinline void intersect(const vbool<K>& valid, const Accel::Intersectors* This, Precalculations& pre, RayHitK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t num, const TravRayK<K, robust> &tray, size_t& lazy_node) {
+        intersectLeaf(valid,pre,ray,context,prim,num);
+      }
+
+      template<bool robust>
+      static __forceinline vbool<K> occluded(const vbool<K>& valid, const Accel::Intersectors* This, Precalculations& pre, RayK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t num, const TravRayK<K, robust> &tray, size_t& lazy_node) {
+        return occludedLeaf(valid,pre,ray,context,prim,num);
+      }
+
+      template<int N, bool robust>
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHitK<K>& ray, size_t k, RayQueryContext* context, const Primitive* prim, size_t num, const TravRay<N,robust> &tray, size_t& lazy_node) {
+        intersectLeaf(vbool<K>(1<<int(k)),pre,ray,context,prim,num);
+      }
+
+      template<int N, bool robust>
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, RayK<K>& ray, size_t k, RayQueryContext* context, const Primitive* prim, size_t num, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        occludedLeaf(vbool<K>(1<<int(k)),pre,ray,context,prim,num);
+        return ray.tfar[k] < 0.0f;
+      }
+    };
+
     typedef ObjectIntersectorK<4,false>  ObjectIntersector4;
     typedef ObjectIntersectorK<8,false>  ObjectIntersector8;
     typedef ObjectIntersectorK<16,false> ObjectIntersector16;
@@ -8,6 +8,8 @@
 #include "grid_soa_intersector1.h"
 #include "grid_soa_intersector_packet.h"
 #include "../common/ray.h"
+#include "../bvh/node_intersector1.h"
+#include "../bvh/bvh_traverser1.h"
 
 namespace embree
 {
@@ -233,5 +235,206 @@ namespace embree
     typedef SubdivPatch1MBIntersectorK<4>  SubdivPatch1MBIntersector4;
     typedef SubdivPatch1MBIntersectorK<8>  SubdivPatch1MBIntersector8;
     typedef SubdivPatch1MBIntersectorK<16> SubdivPatch1MBIntersector16;
+
+    /*! Grids of lazily tessellated patches are built on first access
+     *  inside the shared tessellation cache. As cache segments get
+     *  reused, the thread keeps the cache locked only while it
+     *  traverses the grid, thus the BVH over the grid is traversed
+     *  directly here instead of being pushed as lazy node onto the
+     *  traversal stack of the top level BVH. */
+    struct SubdivPatch1CachedGrid
+    {
+      typedef BVH4::NodeRef NodeRef;
+      static const size_t stackSize = 1+3*BVH4::maxDepth;
+
+      /*! returns the grid of the patch and leaves the thread locked in the tessellation cache */
+      static __forceinline GridSOA* lookup(const Accel::Intersectors* This, const SubdivPatch1* patch)
+      {
+        const BVH4* bvh = (const BVH4*) This->ptr;
+        const SubdivMesh* mesh = bvh->scene->get<SubdivMesh>(patch->geomID());
+        return SharedLazyTessellationCache::lookup(((SubdivPatch1*)patch)->entry(),mesh->getCommitCounter(),[&] () {
+            auto alloc = [] (const size_t bytes) { return SharedLazyTessellationCache::malloc(bytes); };
+            return GridSOA::create(patch,1,bvh->scene,alloc);
+          });
+      }
+
+      /*! traverses the BVH over the grid front to back, the leaf
+       *  function returns the new ray far distance, which is -inf to
+       *  terminate the traversal */
+      template<bool robust, typename LeafFunc>
+      static __forceinline bool traverse(const GridSOA* grid, const TravRay<4,robust>& tray_i, const LeafFunc& leaf)
+      {
+        TravRay<4,robust> tray = tray_i;
+        StackItemT<NodeRef> stack[stackSize];
+        StackItemT<NodeRef>* stackPtr = stack+1;
+        StackItemT<NodeRef>* stackEnd = stack+stackSize;
+        stack[0].ptr  = grid->root(0);
+        stack[0].dist = neg_inf;
+
+        BVHNNodeTraverser1Hit<4,BVH_AN1> nodeTraverser;
+        while (true) pop:
+        {
+          if (unlikely(stackPtr == stack)) break;
+          stackPtr--;
+          NodeRef cur = NodeRef(stackPtr->ptr);
+          if (unlikely(*(float*)&stackPtr->dist > tray.tfar[0]))
+            continue;
+
+          while (true)
+          {
+            size_t mask; vfloat4 tNear;
+            const bool nodeIntersected = BVHNNodeIntersector1<4,BVH_AN1,robust>::intersect(cur,tray,0.0f,tNear,mask);
+            if (unlikely(!nodeIntersected)) break;
+            if (unlikely(mask == 0)) goto pop;
+            nodeTraverser.traverseClosestHit(cur,mask,tNear,stackPtr,stackEnd);
+          }
+
+          size_t ty; const void* prim = (const void*) cur.leaf(ty);
+          const float tfar = leaf(prim);
+          if (tfar == float(neg_inf)) return true;
+          tray.tfar = vfloat4(tfar);
+        }
+        return false;
+      }
+    };
+
+    class SubdivPatch1CachedIntersector1
+    {
+    public:
+      typedef SubdivPatch1 Primitive;
+      typedef SubdivPatch1Precalculations<GridSOAIntersector1::Precalculations> Precalculations;
+
+      /*! Intersect a ray with the primitive. */
+      template<int N, bool robust>
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHit& ray, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        SubdivPatch1CachedGrid::traverse(pre.grid,tray,[&] (const void* leaf) {
+            GridSOAIntersector1::intersect(pre,ray,context,leaf,lazy_node);
+            return ray.tfar;
+          });
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+      }
+
+      template<int N, bool robust>
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHit& ray, RayQueryContext* context, size_t ty0, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node) {
+        intersect(This,pre,ray,context,prim,ty,tray,lazy_node);
+      }
+
+      /*! Test if the ray is occluded by the primitive */
+      template<int N, bool robust>
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, Ray& ray, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        const bool hit = SubdivPatch1CachedGrid::traverse(pre.grid,tray,[&] (const void* leaf) {
+            if (GridSOAIntersector1::occluded(pre,ray,context,leaf,lazy_node)) return float(neg_inf);
+            return ray.tfar;
+          });
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+        return hit;
+      }
+
+      template<int N, bool robust>
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, Ray& ray, RayQueryContext* context, size_t ty0, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node) {
+        return occluded(This,pre,ray,context,prim,ty,tray,lazy_node);
+      }
+
+      template<int N>
+      static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context, const Primitive* prim, size_t ty, const TravPointQuery<N> &tquery, size_t& lazy_node)
+      {
+        assert(false && "not implemented");
+        return false;
+      }
+
+      template<int N>
+      static __forceinline bool pointQuery(const Accel::Intersectors* This, PointQuery* query, PointQueryContext* context, size_t ty0, const Primitive* prim, size_t ty, const TravPointQuery<N> &tquery, size_t& lazy_node) {
+        return pointQuery(This,query,context,prim,ty,tquery,lazy_node);
+      }
+    };
+
+    template <int K>
+      struct SubdivPatch1CachedIntersectorK
+    {
+      typedef SubdivPatch1 Primitive;
+      typedef SubdivPatch1PrecalculationsK<K,typename GridSOAIntersectorK<K>::Precalculations> Precalculations;
+
+      static __forceinline TravRay<4,true> travRay(const RayK<K>& ray, size_t k)
+      {
+        const Vec3fa org(ray.org.x[k],ray.org.y[k],ray.org.z[k]);
+        const Vec3fa dir(ray.dir.x[k],ray.dir.y[k],ray.dir.z[k]);
+        return TravRay<4,true>(org,dir,max(ray.tnear()[k],0.0f),max(ray.tfar[k],0.0f));
+      }
+
+      /* the grid is traversed ray by ray, as it is only built for the rays that hit the patch bounds */
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHitK<K>& ray, size_t k, RayQueryContext* context, GridSOA* grid, const TravRay<4,true>& tray)
+      {
+        size_t lazy_node = 0;
+        SubdivPatch1CachedGrid::traverse(grid,tray,[&] (const void* leaf) {
+            GridSOAIntersectorK<K>::intersect(pre,ray,k,context,leaf,lazy_node);
+            return ray.tfar[k];
+          });
+      }
+
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, RayK<K>& ray, size_t k, RayQueryContext* context, GridSOA* grid, const TravRay<4,true>& tray)
+      {
+        size_t lazy_node = 0;
+        return SubdivPatch1CachedGrid::traverse(grid,tray,[&] (const void* leaf) {
+            if (GridSOAIntersectorK<K>::occluded(pre,ray,k,context,leaf,lazy_node)) return float(neg_inf);
+            return ray.tfar[k];
+          });
+      }
+
+      template<bool robust>
+      static __forceinline void intersect(const vbool<K>& valid, const Accel::Intersectors* This, Precalculations& pre, RayHitK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRayK<K, robust> &tray, size_t& lazy_node)
+      {
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        for (size_t m=movemask(valid); m!=0; ) {
+          const size_t k = bscf(m);
+          intersect(This,pre,ray,k,context,pre.grid,travRay(ray,k));
+        }
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+      }
+
+      template<bool robust>
+      static __forceinline vbool<K> occluded(const vbool<K>& valid, const Accel::Intersectors* This, Precalculations& pre, RayK<K>& ray, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRayK<K, robust> &tray, size_t& lazy_node)
+      {
+        vbool<K> hit = false;
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        for (size_t m=movemask(valid); m!=0; ) {
+          const size_t k = bscf(m);
+          if (occluded(This,pre,ray,k,context,pre.grid,travRay(ray,k)))
+            set(hit,k);
+        }
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+        return hit;
+      }
+
+      template<int N, bool robust>
+      static __forceinline void intersect(const Accel::Intersectors* This, Precalculations& pre, RayHitK<K>& ray, size_t k, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        intersect(This,pre,ray,k,context,pre.grid,tray);
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+      }
+
+      template<int N, bool robust>
+      static __forceinline bool occluded(const Accel::Intersectors* This, Precalculations& pre, RayK<K>& ray, size_t k, RayQueryContext* context, const Primitive* prim, size_t ty, const TravRay<N,robust> &tray, size_t& lazy_node)
+      {
+        pre.grid = SubdivPatch1CachedGrid::lookup(This,prim);
+        const bool hit = occluded(This,pre,ray,k,context,pre.grid,tray);
+        pre.grid = nullptr;
+        SharedLazyTessellationCache::unlock();
+        return hit;
+      }
+    };
+
+    typedef SubdivPatch1CachedIntersectorK<4>  SubdivPatch1CachedIntersector4;
+    typedef SubdivPatch1CachedIntersectorK<8>  SubdivPatch1CachedIntersector8;
+    typedef SubdivPatch1CachedIntersectorK<16> SubdivPatch1CachedIntersector16;
   }
 }
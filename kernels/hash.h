@@ -0,0 +1,4 @@
+// Copyright 2009-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#define RTC_HASH "1c4f97473d4754061f160ca52f82844c704de754"
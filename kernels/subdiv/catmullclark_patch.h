@@ -312,6 +312,14 @@ namespace embree
     __forceinline unsigned size() const { 
       return N; 
     }
+
+    __forceinline BBox3fa bounds() const
+    {
+      BBox3fa bounds (ring[0].bounds());
+      for (size_t i=1; i<N; i++)
+	bounds.extend(ring[i].bounds());
+      return bounds;
+    }
     
     __forceinline bool isQuadPatch() const {
       return (N == 4) && ring[0].only_quads && ring[1].only_quads && ring[2].only_quads && ring[3].only_quads;
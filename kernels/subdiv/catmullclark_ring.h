@@ -645,6 +645,14 @@ namespace embree
 
       assert( hasValidPositions() );
     }
+
+    __forceinline BBox3fa bounds() const
+    {
+      BBox3fa bounds ( vtx );
+      for (size_t i = 0; i<edge_valence ; i++)
+	bounds.extend( ring[i] );
+      return bounds;
+    }
     
     __forceinline void subdivide(CatmullClark1Ring& dest) const
     {
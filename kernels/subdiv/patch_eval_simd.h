@@ -46,6 +46,63 @@ namespace embree
           }
         }
         
+        /* evaluates numQueries points of the same patch, the patch gets
+         * looked up only once and the points get evaluated in chunks of the
+         * SIMD width, u and v have to be padded to a multiple of the SIMD
+         * width and the results of point i get stored at offset i */
+        PatchEvalSimd (SharedLazyTessellationCache::CacheEntry& entry, size_t commitCounter, 
+                       const HalfEdge* edge, const char* vertices, size_t stride, const float* u, const float* v, const size_t numQueries,
+                       float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, const size_t dstride, const size_t N)
+        : P(P), dPdu(dPdu), dPdv(dPdv), ddPdudu(ddPdudu), ddPdvdv(ddPdvdv), ddPdudv(ddPdudv), dstride(dstride), N(N)
+        {
+          /* conservative time for the very first allocation */
+          auto time = SharedLazyTessellationCache::sharedLazyTessellationCache.getTime(commitCounter);
+
+          Ref patch = SharedLazyTessellationCache::lookup(entry,commitCounter,[&] () {
+              auto alloc = [](size_t bytes) { return SharedLazyTessellationCache::malloc(bytes); };
+              return Patch::create(alloc,edge,vertices,stride);
+            }, true);
+
+          auto curTime = SharedLazyTessellationCache::sharedLazyTessellationCache.getTime(commitCounter);
+          const bool allAllocationsValid = SharedLazyTessellationCache::validTime(time,curTime);
+          
+          patch = allAllocationsValid ? patch : nullptr;
+
+          /* use cached data structure for calculations, chunks that cannot get evaluated that way are remembered */
+          std::vector<size_t> failed;
+          for (size_t i=0; i<numQueries; i+=vfloat::size)
+          {
+            const vbool valid0 = vint(int(i))+vint(step) < vint(int(numQueries));
+            setOffset(P,dPdu,dPdv,ddPdudu,ddPdvdv,ddPdudv,i);
+            const vbool valid1 = patch ? eval(valid0,patch,vfloat::load(&u[i]),vfloat::load(&v[i]),1.0f,0) : vbool(false);
+            if (any(valid0 & !valid1)) failed.push_back(i);
+          }
+          SharedLazyTessellationCache::unlock();
+
+          for (size_t i : failed)
+          {
+            const vbool valid0 = vint(int(i))+vint(step) < vint(int(numQueries));
+            setOffset(P,dPdu,dPdv,ddPdudu,ddPdvdv,ddPdudv,i);
+            FeatureAdaptiveEvalSimd<vbool,vint,vfloat,Vertex,Vertex_t>(edge,vertices,stride,valid0,vfloat::load(&u[i]),vfloat::load(&v[i]),
+                                                                       this->P,this->dPdu,this->dPdv,this->ddPdudu,this->ddPdvdv,this->ddPdudv,dstride,N);
+          }
+        }
+
+      private:
+
+        /* points the outputs to the chunk starting at query i */
+        __forceinline void setOffset(float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t i)
+        {
+          this->P       = P       ? P+i       : nullptr;
+          this->dPdu    = dPdu    ? dPdu+i    : nullptr;
+          this->dPdv    = dPdv    ? dPdv+i    : nullptr;
+          this->ddPdudu = ddPdudu ? ddPdudu+i : nullptr;
+          this->ddPdvdv = ddPdvdv ? ddPdvdv+i : nullptr;
+          this->ddPdudv = ddPdudv ? ddPdudv+i : nullptr;
+        }
+
+      public:
+        
         vbool eval_quad(const vbool& valid, const typename Patch::SubdividedQuadPatch* This, const vfloat& u, const vfloat& v, const float dscale, const size_t depth)
         {
           vbool ret = false;
@@ -114,12 +171,12 @@ namespace embree
         }
 
       private:
-        float* const P;
-        float* const dPdu;
-        float* const dPdv;
-        float* const ddPdudu;
-        float* const ddPdvdv;
-        float* const ddPdudv;
+        float* P;
+        float* dPdu;
+        float* dPdv;
+        float* ddPdudu;
+        float* ddPdvdv;
+        float* ddPdudv;
         const size_t dstride;
         const size_t N;
       };
@@ -35,6 +35,7 @@ namespace embree
     localTime              = NUM_CACHE_SEGMENTS;
     next_block             = 0;
     numRenderThreads       = 0;
+    numFlushes             = 0;
 #if FORCE_SIMPLE_FLUSH == 1
     switch_block_threshold = maxBlocks;
 #else
@@ -113,6 +114,7 @@ namespace embree
 #endif
         
         CACHE_STATS(SharedTessellationCacheStats::cache_flushes++);
+        numFlushes++;
         
         /* release all blocked threads */
         
@@ -132,6 +134,35 @@ namespace embree
   }
   
   
+  SharedLazyTessellationCache::Stats SharedLazyTessellationCache::getStats()
+  {
+    Stats stats;
+    linkedlist_mtx.lock();
+    for (ThreadWorkState *t=current_t_state;t!=nullptr;t=t->next) {
+      stats.hits   += t->hits.load(std::memory_order_relaxed);
+      stats.misses += t->misses.load(std::memory_order_relaxed);
+    }
+    stats.flushes = numFlushes;
+    stats.hits    -= statsBase.hits;
+    stats.misses  -= statsBase.misses;
+    stats.flushes -= statsBase.flushes;
+    linkedlist_mtx.unlock();
+    return stats;
+  }
+
+  void SharedLazyTessellationCache::resetStats()
+  {
+    /* the per thread counters are only written by their owning
+     * thread, thus we remember the current values as base instead of
+     * clearing the counters */
+    const Stats stats = getStats();
+    linkedlist_mtx.lock();
+    statsBase.hits    += stats.hits;
+    statsBase.misses  += stats.misses;
+    statsBase.flushes += stats.flushes;
+    linkedlist_mtx.unlock();
+  }
+
   void SharedLazyTessellationCache::reset()
   {
     /* lock the reset_state */
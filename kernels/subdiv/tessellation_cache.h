@@ -49,8 +49,12 @@ namespace embree
    ThreadWorkState* next;
    bool allocated;
 
+   /* per thread statistics, only written by the owning thread */
+   std::atomic<size_t> hits;
+   std::atomic<size_t> misses;
+
    __forceinline ThreadWorkState(bool allocated = false) 
-     : counter(0), next(nullptr), allocated(allocated) 
+     : counter(0), next(nullptr), allocated(allocated), hits(0), misses(0)
    {
      assert( ((size_t)this % 64) == 0 ); 
    }   
@@ -119,6 +123,15 @@ namespace embree
 
    static __forceinline size_t extractCommitIndex(const int64_t v) { return v >> SharedLazyTessellationCache::COMMIT_INDEX_SHIFT; }
 
+   struct Stats
+   {
+     __forceinline Stats() : hits(0), misses(0), flushes(0) {}
+
+     size_t hits;     //!< number of lookups that found a valid cache entry
+     size_t misses;   //!< number of lookups that had to build the cache entry
+     size_t flushes;  //!< number of cache segments that got invalidated
+   };
+
    struct CacheEntry
    {
      Tag tag;
@@ -139,7 +152,8 @@ namespace embree
    __aligned(64) SpinLock   linkedlist_mtx;
    __aligned(64) std::atomic<size_t> switch_block_threshold;
    __aligned(64) std::atomic<size_t> numRenderThreads;
-
+   __aligned(64) std::atomic<size_t> numFlushes;
+   Stats statsBase; //!< counter values at the last statistics reset
 
  public:
 
@@ -222,12 +236,16 @@ namespace embree
      {
        sharedLazyTessellationCache.lockThreadLoop(t_state);
        void* patch = SharedLazyTessellationCache::lookup(entry,globalTime);
-       if (patch) return (decltype(constructor())) patch;
+       if (patch) {
+         countEvent(t_state->hits);
+         return (decltype(constructor())) patch;
+       }
        
        if (entry.mutex.try_lock())
        {
          if (!validTag(entry.tag,globalTime)) 
          {
+           countEvent(t_state->misses);
            auto timeBefore = sharedLazyTessellationCache.getTime(globalTime);
            auto ret = constructor(); // thread is locked here!
            assert(ret);
@@ -269,6 +287,15 @@ namespace embree
       return sharedLazyTessellationCache.validCacheIndex(subdiv_patch_cache_index,globalTime);
     }
 
+   /* only the owning thread increments its counters, thus no atomic read-modify-write is required */
+   static __forceinline void countEvent(std::atomic<size_t>& counter) {
+     counter.store(counter.load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+   }
+
+   /* returns the statistics accumulated over all threads since the last reset */
+   Stats getStats();
+   void resetStats();
+
    void waitForUsersLessEqual(ThreadWorkState *const t_state,
 			      const unsigned int users);
     
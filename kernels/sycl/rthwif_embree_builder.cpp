@@ -359,7 +359,7 @@ namespace embree
 
   void createGeometryDesc(ze_rtas_builder_instance_geometry_info_exp_t* out, Scene* scene, Instance* geom)
   {
-    assert(geom->gsubtype == AccelSet::GTY_SUBTYPE_DEFAULT);
+    assert(geom->gsubtype != AccelSet::GTY_SUBTYPE_INSTANCE_QUATERNION); // linear or cubic interpolation is irrelevant without motion blur
     memset(out,0,sizeof(ze_rtas_builder_instance_geometry_info_exp_t));
     out->geometryType = ZE_RTAS_BUILDER_GEOMETRY_TYPE_EXP_INSTANCE;
     out->instanceFlags = 0;
@@ -6,12 +6,16 @@
 namespace embree {
 
 /* configuration */
-#define EDGE_LEVEL 256.0f
+#define TESSELLATION_RATE 256.0f
+#define MAX_DISPLACEMENT 0.6f
 #define ENABLE_SMOOTH_NORMALS 0
 
 /* scene data */
 RTCScene g_scene = nullptr;
 
+/* ID of the displaced cube */
+unsigned int g_cubeID = RTC_INVALID_GEOMETRY_ID;
+
 /* previous camera position */
 Vec3fa old_p;
 
@@ -117,10 +121,9 @@ unsigned int addCube (RTCScene scene_i)
   rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX,  0, RTC_FORMAT_UINT,   cube_indices,  0, sizeof(unsigned int), NUM_INDICES);
   rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_FACE,   0, RTC_FORMAT_UINT,   cube_faces,    0, sizeof(unsigned int), NUM_FACES);
 
-  float* level = (float*) rtcSetNewGeometryBuffer(geom, RTC_BUFFER_TYPE_LEVEL, 0, RTC_FORMAT_FLOAT, sizeof(float), NUM_INDICES);
-  for (size_t i=0; i<NUM_INDICES; i++) level[i] = EDGE_LEVEL;
-
+  /* edge levels get calculated from the camera position in device_render */
   rtcSetGeometryDisplacementFunction(geom,displacementFunction);
+  rtcSetGeometryMaxDisplacement(geom,MAX_DISPLACEMENT);
 
   rtcCommitGeometry(geom);
   unsigned int geomID = rtcAttachGeometry(scene_i,geom);
@@ -163,7 +166,8 @@ extern "C" void device_init (char* cfg)
   addGroundPlane(g_scene);
 
   /* add cube */
-  addCube(g_scene);
+  g_cubeID = addCube(g_scene);
+  old_p = Vec3fa(1E10);
 
   /* commit changes to scene */
   rtcCommitScene (g_scene);
@@ -282,6 +286,15 @@ extern "C" void device_render (int* pixels,
                            const float time,
                            const ISPCCamera& camera)
 {
+  /* update edge levels if camera changed */
+  if (ne(camera.xfm.p,old_p))
+  {
+    old_p = camera.xfm.p;
+    RTCGeometry geom = rtcGetGeometry(g_scene,g_cubeID);
+    rtcSetGeometryTessellationCamera(geom,old_p.x,old_p.y,old_p.z,TESSELLATION_RATE);
+    rtcCommitGeometry(geom);
+    rtcCommitScene(g_scene);
+  }
 }
 
 /* called by the C++ code for cleanup */
@@ -2,18 +2,101 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "../common/tutorial/tutorial.h"
+#include "../common/scenegraph/geometry_creation.h"
 
 namespace embree
 {
-  struct Tutorial : public TutorialApplication 
+  size_t g_benchmark_interpolate = 0;
+
+  /* measures rtcInterpolateN throughput for random queries on a subdivision sphere, once
+   * issued in small blocks and once as a single large query set that gets evaluated patch
+   * by patch */
+  void benchmarkInterpolate(const std::string& cfg, size_t numQueries)
+  {
+    RTCDevice device = rtcNewDevice(cfg.c_str());
+    Ref<SceneGraph::SubdivMeshNode> mesh = SceneGraph::createSubdivSphere(zero,1.0f,24,16).dynamicCast<SceneGraph::SubdivMeshNode>();
+
+    RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SUBDIVISION);
+    rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3, mesh->positions[0].data(), 0, sizeof(SceneGraph::SubdivMeshNode::Vertex), mesh->positions[0].size());
+    rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX,  0, RTC_FORMAT_UINT,   mesh->position_indices.data(), 0, sizeof(unsigned int), mesh->position_indices.size());
+    rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_FACE,   0, RTC_FORMAT_UINT,   mesh->verticesPerFace.data(), 0, sizeof(unsigned int), mesh->verticesPerFace.size());
+    rtcCommitGeometry(geom);
+
+    RandomSampler sampler;
+    RandomSampler_init(sampler,0);
+    std::vector<unsigned int> primIDs(numQueries);
+    std::vector<float> u(numQueries), v(numQueries);
+    for (size_t i=0; i<numQueries; i++) {
+      primIDs[i] = RandomSampler_getUInt(sampler) % (unsigned int) mesh->verticesPerFace.size();
+      u[i] = RandomSampler_get1D(sampler);
+      v[i] = RandomSampler_get1D(sampler);
+    }
+    std::vector<float> P(3*numQueries), dPdu(3*numQueries), dPdv(3*numQueries);
+
+    auto interpolate = [&] (size_t blockSize) -> double
+    {
+      const double t0 = getSeconds();
+      for (size_t i=0; i<numQueries; i+=blockSize)
+      {
+        RTCInterpolateNArguments args;
+        args.geometry = geom;
+        args.valid = nullptr;
+        args.primIDs = primIDs.data()+i;
+        args.u = u.data()+i;
+        args.v = v.data()+i;
+        args.N = (unsigned int) min(blockSize,numQueries-i);
+        args.bufferType = RTC_BUFFER_TYPE_VERTEX;
+        args.bufferSlot = 0;
+        args.P = P.data()+3*i;
+        args.dPdu = dPdu.data()+3*i;
+        args.dPdv = dPdv.data()+3*i;
+        args.ddPdudu = nullptr;
+        args.ddPdvdv = nullptr;
+        args.ddPdudv = nullptr;
+        args.valueCount = 3;
+        rtcInterpolateN(&args);
+      }
+      return getSeconds()-t0;
+    };
+
+    /* first pass fills the patch cache */
+    interpolate(numQueries);
+
+    const size_t blockSizes[2] = { 8, numQueries };
+    for (size_t blockSize : blockSizes)
+    {
+      double dt = inf;
+      for (size_t i=0; i<3; i++) dt = min(dt,interpolate(blockSize));
+      std::cout << "rtcInterpolateN " << numQueries << " queries in blocks of " << blockSize << ": "
+                << 1E-6*double(numQueries)/dt << " Mqueries/s" << std::endl;
+    }
+
+    rtcReleaseGeometry(geom);
+    rtcReleaseDevice(device);
+  }
+
+  struct Tutorial : public TutorialApplication
   {
     Tutorial()
       : TutorialApplication("interpolation",FEATURE_RTCORE)
     {
+      registerOption("benchmark_interpolate", [this] (Ref<ParseStream> cin, const FileName& path) {
+          g_benchmark_interpolate = cin->getInt();
+          interactive = false;
+        }, "--benchmark_interpolate <int>: measures rtcInterpolateN performance for the specified number of random queries");
+
       /* set default camera */
       camera.from = Vec3fa(9.0f,4.0f,1.0f);
       camera.to   = Vec3fa(0.0f,0.0f,1.0f);
     }
+
+    int main(int argc, char** argv) override
+    {
+      const int ret = TutorialApplication::main(argc,argv);
+      if (ret == 0 && g_benchmark_interpolate)
+        benchmarkInterpolate(rtcore,g_benchmark_interpolate);
+      return ret;
+    }
   };
 
 }
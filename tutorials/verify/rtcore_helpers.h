@@ -808,6 +808,65 @@ namespace embree
       IntersectWithModeInternal(mode,ivariant,scene,rays,N,args);
   }
 
+  template<typename RTCRayHitK, typename RTCRayK, int K>
+  void IntersectTileK(IntersectVariant ivariant, RTCScene scene, RTCRayHit* rays, unsigned int N, RTCIntersectArguments* args)
+  {
+    const unsigned int numPackets = (N+K-1)/K;
+    vector_t<RTCRayHitK,aligned_allocator<RTCRayHitK,4*K>> packets(numPackets);
+    vector_t<int,aligned_allocator<int,4*K>> valid(K*numPackets);
+    for (size_t i=0; i<K*numPackets; i++)
+    {
+      if (i<N) {
+        valid[i] = rays[i].ray.tnear <= rays[i].ray.tfar ? -1 : 0;
+        setRay(packets[i/K],i%K,rays[i]);
+      } else {
+        valid[i] = 0;
+        setRay(packets[i/K],i%K,makeRay(zero,zero,pos_inf,neg_inf));
+      }
+    }
+    switch (ivariant & VARIANT_INTERSECT_OCCLUDED_MASK) {
+    case VARIANT_INTERSECT:
+      if      (K ==  4) rtcIntersectTile4 (valid.data(),scene,(RTCRayHit4* )packets.data(),numPackets,args);
+      else if (K ==  8) rtcIntersectTile8 (valid.data(),scene,(RTCRayHit8* )packets.data(),numPackets,args);
+      else if (K == 16) rtcIntersectTile16(valid.data(),scene,(RTCRayHit16*)packets.data(),numPackets,args);
+      break;
+    case VARIANT_OCCLUDED:
+    {
+      /* occlusion rays are passed without hit data, thus with a smaller packet stride */
+      vector_t<RTCRayK,aligned_allocator<RTCRayK,4*K>> shadow(numPackets);
+      for (size_t i=0; i<numPackets; i++) shadow[i] = packets[i].ray;
+      if      (K ==  4) rtcOccludedTile4 (valid.data(),scene,(RTCRay4* )shadow.data(),numPackets,(RTCOccludedArguments*)args);
+      else if (K ==  8) rtcOccludedTile8 (valid.data(),scene,(RTCRay8* )shadow.data(),numPackets,(RTCOccludedArguments*)args);
+      else if (K == 16) rtcOccludedTile16(valid.data(),scene,(RTCRay16*)shadow.data(),numPackets,(RTCOccludedArguments*)args);
+      for (size_t i=0; i<numPackets; i++) packets[i].ray = shadow[i];
+      break;
+    }
+    default: assert(false);
+    }
+    for (size_t i=0; i<N; i++) rays[i] = getRay(packets[i/K],i%K);
+  }
+
+  /* traces all rays as one coherent tile of ray packets */
+  void IntersectTileWithMode(IntersectMode mode, IntersectVariant ivariant, RTCScene scene, RTCRayHit* rays, unsigned int N, RTCIntersectArguments* args = nullptr)
+  {
+    RTCIntersectArguments _args;
+    if (!args)
+    {
+      rtcInitIntersectArguments(&_args);
+      args = &_args;
+    }
+    args->flags = (RTCRayQueryFlags) (args->flags | RTC_RAY_QUERY_FLAG_COHERENT);
+
+    switch (mode)
+    {
+    case MODE_INTERSECT_NONE: break;
+    case MODE_INTERSECT1    : IntersectWithModeInternal(mode,ivariant,scene,rays,N,args); break;
+    case MODE_INTERSECT4    : IntersectTileK<RTCRayHit4, RTCRay4, 4>(ivariant,scene,rays,N,args); break;
+    case MODE_INTERSECT8    : IntersectTileK<RTCRayHit8, RTCRay8, 8>(ivariant,scene,rays,N,args); break;
+    case MODE_INTERSECT16   : IntersectTileK<RTCRayHit16,RTCRay16,16>(ivariant,scene,rays,N,args); break;
+    }
+  }
+
   enum GeometryType
   {
     TRIANGLE_MESH,
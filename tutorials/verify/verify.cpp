@@ -2062,6 +2062,60 @@ namespace embree
       passed &= checkInterpolationSharpVertex(geom,2,1.0f,0.0f,3,bufferType,bufferSlot,vertices0,N,N_total);
       return passed;
     }
+
+    /* rtcInterpolateN evaluates large query sets patch by patch, results have to match rtcInterpolate2 */
+    bool checkSubdivInterpolationN(RTCGeometry geom, RTCBufferType bufferType, unsigned int bufferSlot, unsigned int N)
+    {
+      const unsigned int Q = 1024;
+      std::vector<int> valid(Q);
+      std::vector<unsigned int> primIDs(Q);
+      std::vector<float> u(Q), v(Q);
+      for (unsigned int i=0; i<Q; i++) {
+        valid[i] = (i%7) ? -1 : 0;
+        primIDs[i] = (unsigned int) (random_int() % num_interpolation_quad_faces);
+        u[i] = random_float();
+        v[i] = random_float();
+      }
+      std::vector<float> P(N*Q,-1.0f), dPdu(N*Q,-1.0f), dPdv(N*Q,-1.0f), ddPdudu(N*Q,-1.0f), ddPdvdv(N*Q,-1.0f), ddPdudv(N*Q,-1.0f);
+      RTCInterpolateNArguments args;
+      args.geometry = geom;
+      args.valid = valid.data();
+      args.primIDs = primIDs.data();
+      args.u = u.data();
+      args.v = v.data();
+      args.N = Q;
+      args.bufferType = bufferType;
+      args.bufferSlot = bufferSlot;
+      args.P = P.data();
+      args.dPdu = dPdu.data();
+      args.dPdv = dPdv.data();
+      args.ddPdudu = ddPdudu.data();
+      args.ddPdvdv = ddPdvdv.data();
+      args.ddPdudv = ddPdudv.data();
+      args.valueCount = N;
+      rtcInterpolateN(&args);
+
+      bool passed = true;
+      for (unsigned int i=0; i<Q; i++)
+      {
+        float P1[256], dPdu1[256], dPdv1[256], ddPdudu1[256], ddPdvdv1[256], ddPdudv1[256];
+        rtcInterpolate2(geom,primIDs[i],u[i],v[i],bufferType,bufferSlot,P1,dPdu1,dPdv1,ddPdudu1,ddPdvdv1,ddPdudv1,N);
+        for (unsigned int j=0; j<N; j++)
+        {
+          if (valid[i] != -1) {
+            passed &= P[j*Q+i] == -1.0f && dPdu[j*Q+i] == -1.0f && ddPdudv[j*Q+i] == -1.0f;
+            continue;
+          }
+          passed &= fabsf(P[j*Q+i]-P1[j]) < 1E-4f;
+          passed &= fabsf(dPdu[j*Q+i]-dPdu1[j]) < 1E-3f;
+          passed &= fabsf(dPdv[j*Q+i]-dPdv1[j]) < 1E-3f;
+          passed &= fabsf(ddPdudu[j*Q+i]-ddPdudu1[j]) < 1E-2f;
+          passed &= fabsf(ddPdvdv[j*Q+i]-ddPdvdv1[j]) < 1E-2f;
+          passed &= fabsf(ddPdudv[j*Q+i]-ddPdudv1[j]) < 1E-2f;
+        }
+      }
+      return passed;
+    }
     
     VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
     {
@@ -2115,6 +2169,9 @@ namespace embree
       passed &= checkSubdivInterpolation(device,geom,RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE,0,user_vertices0.data(),1,N);
       passed &= checkSubdivInterpolation(device,geom,RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE,1,user_vertices1.data(),1,N);
 
+      passed &= checkSubdivInterpolationN(geom,RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE,0,N);
+      AssertNoError(device);
+
       rtcReleaseGeometry(geom);
       AssertNoError(device);
 
@@ -2122,6 +2179,63 @@ namespace embree
     }
   };
 
+  struct TessellationCacheStatsTest : public VerifyApplication::Test
+  {
+    TessellationCacheStatsTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_SUBDIVISION_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* the device budget has to be reflected in the size of the shared cache */
+      const ssize_t budget = 256*1024*1024;
+      rtcSetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE,budget);
+      AssertNoError(device);
+      if (rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE) < budget)
+        return VerifyApplication::FAILED;
+
+      RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SUBDIVISION);
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT, interpolation_quad_indices, 0, sizeof(unsigned int), num_interpolation_quad_faces*4);
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_FACE,  0, RTC_FORMAT_UINT, interpolation_quad_faces,   0, sizeof(unsigned int), num_interpolation_quad_faces);
+      std::vector<Vec3fa> vertices(num_interpolation_vertices);
+      for (size_t i=0; i<num_interpolation_vertices; i++) vertices[i] = Vec3fa(random_float(),random_float(),random_float());
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3, vertices.data(), 0, sizeof(Vec3fa), num_interpolation_vertices);
+      rtcCommitGeometry(geom);
+      AssertNoError(device);
+
+      rtcSetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_HITS,0);
+      AssertNoError(device);
+
+      /* the first lookup of a patch misses, the following lookups hit */
+      const size_t numLookups = 10;
+      float P[3];
+      for (size_t i=0; i<numLookups; i++)
+        rtcInterpolate1(geom,4,0.5f,0.5f,RTC_BUFFER_TYPE_VERTEX,0,P,nullptr,nullptr,3);
+      AssertNoError(device);
+
+      const ssize_t hits   = rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_HITS);
+      const ssize_t misses = rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES);
+      AssertNoError(device);
+      if (misses < 1 || hits < ssize_t(numLookups-1))
+        return VerifyApplication::FAILED;
+
+      /* only resetting to zero is allowed */
+      rtcSetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES,1);
+      AssertError(device,RTC_ERROR_INVALID_ARGUMENT);
+      
+      rtcReleaseGeometry(geom);
+      rtcSetDeviceProperty(device,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_SIZE,0);
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
   struct InterpolateTrianglesTest : public VerifyApplication::Test
   {
     size_t N;
@@ -2449,43 +2563,1113 @@ namespace embree
       rtcCommitScene (scene);
       AssertNoError(device);
 
-      float u[256], v[256];
-      RTCRayHit rays[256];
-      for (size_t i=0; i<256; i++)
+      float u[256], v[256];
+      RTCRayHit rays[256];
+      for (size_t i=0; i<256; i++)
+      {
+        u[i] = random_float(); 
+        v[i] = random_float();
+        Vec3fa from(0.0f,0.0f,-1.0f);
+        Vec3fa to = uniformSampleTriangle(vertices[1],vertices[2],vertices[0],u[i],v[i]);
+        rays[i] = makeRay(from,to-from);
+      }
+      IntersectWithMode(imode,ivariant,scene,rays,256);
+
+      for (size_t i=0; i<256; i++)
+      {
+        
+        if (!(ivariant & VARIANT_INTERSECT)) 
+        {
+          if (rays[i].ray.tfar != float(neg_inf)) return VerifyApplication::FAILED;          
+          continue;
+        }
+
+
+        if (rays[i].hit.geomID != 0) return VerifyApplication::FAILED;
+        if (rays[i].hit.primID != 0) return VerifyApplication::FAILED;
+        if (abs(rays[i].hit.u - u[i]) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
+        if (abs(rays[i].hit.v - v[i]) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
+        if (abs(rays[i].ray.tfar - 1.0f) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
+        const Vec3fa org(rays[i].ray.org_x,rays[i].ray.org_y,rays[i].ray.org_z);
+        const Vec3fa dir(rays[i].ray.dir_x,rays[i].ray.dir_y,rays[i].ray.dir_z);
+        const Vec3fa ht  = org + rays[i].ray.tfar*dir;
+        const Vec3fa huv = vertices[0] + rays[i].hit.u*(vertices[1]-vertices[0]) + rays[i].hit.v*(vertices[2]-vertices[0]);
+        if (reduce_max(abs(ht-huv)) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
+        const Vec3fa Ng = Vec3fa(rays[i].hit.Ng_x,rays[i].hit.Ng_y,rays[i].hit.Ng_z);
+        if (reduce_max(abs(Ng - Vec3fa(0.0f,0.0f,1.0f))) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct LazySubdivTest : public VerifyApplication::IntersectTest
+  {
+    LazySubdivTest (std::string name, int isa, IntersectMode imode, IntersectVariant ivariant)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+",subdiv_accel=bvh4.grid.lazy").c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device1));
+
+      if (!rtcGetDeviceProperty(device0,RTC_DEVICE_PROPERTY_SUBDIVISION_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* the same mesh gets tessellated eagerly and lazily */
+      RandomSampler sampler;
+      RandomSampler_init(sampler,0);
+      Ref<SceneGraph::Node> node = SceneGraph::createSubdivSphere(zero,1.0f,8,16);
+      addRandomSubdivFeatures(sampler,node.dynamicCast<SceneGraph::SubdivMeshNode>(),10,10,0);
+      VerifyScene scene0(device0,SceneFlags(RTC_SCENE_FLAG_NONE,RTC_BUILD_QUALITY_MEDIUM));
+      VerifyScene scene1(device1,SceneFlags(RTC_SCENE_FLAG_NONE,RTC_BUILD_QUALITY_MEDIUM));
+      scene0.addGeometry(RTC_BUILD_QUALITY_MEDIUM,node);
+      scene1.addGeometry(RTC_BUILD_QUALITY_MEDIUM,node);
+      rtcCommitScene(scene0);
+      rtcCommitScene(scene1);
+      AssertNoError(device0);
+      AssertNoError(device1);
+
+      const size_t N = 256;
+      RTCRayHit rays0[N], rays1[N];
+      for (size_t i=0; i<N; i++)
+      {
+        const Vec3fa org = 3.0f*normalize(Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f));
+        const Vec3fa dst = 0.5f*Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f);
+        rays0[i] = rays1[i] = makeRay(org,dst-org);
+      }
+      rtcSetDeviceProperty(device1,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES,0);
+      IntersectWithMode(imode,ivariant,scene0,rays0,N);
+      IntersectWithMode(imode,ivariant,scene1,rays1,N);
+      AssertNoError(device0);
+      AssertNoError(device1);
+
+      /* grids of the lazy device have to get built during traversal */
+      if (rtcGetDeviceProperty(device1,RTC_DEVICE_PROPERTY_TESSELLATION_CACHE_MISSES) == 0)
+        return VerifyApplication::FAILED;
+
+      for (size_t i=0; i<N; i++)
+      {
+        if (!(ivariant & VARIANT_INTERSECT))
+        {
+          if (rays0[i].ray.tfar != rays1[i].ray.tfar) return VerifyApplication::FAILED;
+          continue;
+        }
+        if (rays0[i].hit.geomID != rays1[i].hit.geomID) return VerifyApplication::FAILED;
+        if (rays0[i].hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (rays0[i].hit.primID != rays1[i].hit.primID) return VerifyApplication::FAILED;
+        if (abs(rays0[i].ray.tfar - rays1[i].ray.tfar) > 1E-4f) return VerifyApplication::FAILED;
+        if (abs(rays0[i].hit.u - rays1[i].hit.u) > 1E-3f) return VerifyApplication::FAILED;
+        if (abs(rays0[i].hit.v - rays1[i].hit.v) > 1E-3f) return VerifyApplication::FAILED;
+      }
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct AdaptiveTessellationTest : public VerifyApplication::Test
+  {
+    AdaptiveTessellationTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    static void displacementFunction(const RTCDisplacementFunctionNArguments* args)
+    {
+      for (unsigned int i=0; i<args->N; i++) {
+        args->P_x[i] += 0.1f*args->Ng_x[i];
+        args->P_y[i] += 0.1f*args->Ng_y[i];
+        args->P_z[i] += 0.1f*args->Ng_z[i];
+      }
+    }
+
+    RTCScene createScene(RTCDevice device, const Ref<SceneGraph::SubdivMeshNode>& mesh, const Vec3fa& cam, float maxDisplacement)
+    {
+      RTCScene scene = rtcNewScene(device);
+      RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SUBDIVISION);
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3, mesh->positions[0].data(), 0, sizeof(SceneGraph::SubdivMeshNode::Vertex), mesh->positions[0].size());
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX,  0, RTC_FORMAT_UINT,   mesh->position_indices.data(), 0, sizeof(unsigned int), mesh->position_indices.size());
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_FACE,   0, RTC_FORMAT_UINT,   mesh->verticesPerFace.data(), 0, sizeof(unsigned int), mesh->verticesPerFace.size());
+      rtcSetGeometryDisplacementFunction(geom,displacementFunction);
+      rtcSetGeometryMaxDisplacement(geom,maxDisplacement);
+      rtcSetGeometryTessellationCamera(geom,cam.x,cam.y,cam.z,64.0f);
+      rtcCommitGeometry(geom);
+      rtcAttachGeometry(scene,geom);
+      rtcReleaseGeometry(geom);
+      rtcCommitScene(scene);
+      return scene;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+",subdiv_accel=bvh4.grid.lazy").c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device1));
+
+      if (!rtcGetDeviceProperty(device0,RTC_DEVICE_PROPERTY_SUBDIVISION_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* only subdivision geometries support adaptive tessellation */
+      RTCGeometry tris = rtcNewGeometry(device0, RTC_GEOMETRY_TYPE_TRIANGLE);
+      rtcSetGeometryTessellationCamera(tris,0.0f,0.0f,0.0f,1.0f);
+      AssertError(device0,RTC_ERROR_INVALID_OPERATION);
+      rtcReleaseGeometry(tris);
+
+      Ref<SceneGraph::SubdivMeshNode> mesh = SceneGraph::createSubdivSphere(zero,1.0f,8,16).dynamicCast<SceneGraph::SubdivMeshNode>();
+      RTCGeometry geom = rtcNewGeometry(device0, RTC_GEOMETRY_TYPE_SUBDIVISION);
+      rtcSetGeometryMaxDisplacement(geom,-1.0f);
+      AssertError(device0,RTC_ERROR_INVALID_ARGUMENT);
+      rtcReleaseGeometry(geom);
+
+      /* the lazy device uses the displacement bound instead of exact patch bounds,
+       * both devices have to tessellate the mesh identically */
+      const Vec3fa cam(0.0f,0.0f,-3.0f);
+      RTCSceneRef scene0 = createScene(device0,mesh,cam,0.0f);
+      RTCSceneRef scene1 = createScene(device1,mesh,cam,0.1f);
+      AssertNoError(device0);
+      AssertNoError(device1);
+
+      for (size_t i=0; i<256; i++)
+      {
+        const Vec3fa dst = 0.5f*Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f);
+        RTCRayHit ray0 = makeRay(cam,dst-cam), ray1 = ray0;
+        rtcIntersect1(scene0,&ray0);
+        rtcIntersect1(scene1,&ray1);
+        if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) return VerifyApplication::FAILED;
+        if (ray1.hit.geomID == RTC_INVALID_GEOMETRY_ID) return VerifyApplication::FAILED;
+        if (abs(ray0.ray.tfar - ray1.ray.tfar) > 1E-3f*ray0.ray.tfar) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device0);
+      AssertNoError(device1);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct CurveLODTest : public VerifyApplication::Test
+  {
+    CurveLODTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_CURVE_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* only curve geometries support LOD ranges */
+      RTCGeometry tris = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_TRIANGLE);
+      rtcSetGeometryLODRange(tris,0.0f,1.0f);
+      AssertError(device,RTC_ERROR_INVALID_OPERATION);
+      rtcReleaseGeometry(tris);
+
+      /* 8 parallel strands along the x-axis, each made of 4 bezier segments */
+      const unsigned int numStrands = 8, numSegments = 4;
+      RTCGeometry hair = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_ROUND_BEZIER_CURVE);
+      rtcSetGeometryLODRange(hair,-1.0f,1.0f);
+      AssertError(device,RTC_ERROR_INVALID_ARGUMENT);
+      unsigned int* indices = (unsigned int*) rtcSetNewGeometryBuffer(hair,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT,sizeof(unsigned int),numStrands*numSegments);
+      Vec3ff* vertices = (Vec3ff*) rtcSetNewGeometryBuffer(hair,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT4,sizeof(Vec3ff),numStrands*(3*numSegments+1));
+      for (unsigned int s=0; s<numStrands; s++)
+      {
+        for (unsigned int j=0; j<numSegments; j++)
+          indices[s*numSegments+j] = s*(3*numSegments+1)+3*j;
+        for (unsigned int j=0; j<3*numSegments+1; j++)
+          vertices[s*(3*numSegments+1)+j] = Vec3ff(float(j)/float(3*numSegments),0.01f*float(s),0.0f,0.002f);
+      }
+      rtcNewCurveLODGeometry(hair,2,4);
+      AssertError(device,RTC_ERROR_INVALID_OPERATION);
+      rtcCommitGeometry(hair);
+
+      /* merges pairs of segments and groups of 4 strands into 2x2 ribbon segments */
+      RTCGeometry lod = rtcNewCurveLODGeometry(hair,2,4);
+      AssertNoError(device);
+      rtcSetGeometryLODRange(hair,0.0f,5.0f);
+      rtcSetGeometryLODRange(lod,5.0f,float(inf));
+      rtcCommitGeometry(lod);
+
+      RTCSceneRef scene = rtcNewScene(device);
+      const unsigned int hairID = rtcAttachGeometry(scene,hair);
+      const unsigned int lodID = rtcAttachGeometry(scene,lod);
+      rtcReleaseGeometry(hair);
+      rtcReleaseGeometry(lod);
+      rtcCommitScene(scene);
+      AssertNoError(device);
+
+      for (size_t i=0; i<32; i++)
+      {
+        /* stay away from segment boundaries where neighboring segments overlap */
+        const float x = (float(i%8)+0.25f+0.5f*random_float())/8.0f;
+        for (unsigned int s=0; s<numStrands; s++)
+        {
+          /* rays through a strand hit the strand up close and the ribbon from far away */
+          RTCRayHit near0 = makeRay(Vec3fa(x,0.01f*float(s),-2.0f),Vec3fa(0,0,1));
+          RTCRayHit far0  = makeRay(Vec3fa(x,0.01f*float(s),-10.0f),Vec3fa(0,0,1));
+          rtcIntersect1(scene,&near0);
+          rtcIntersect1(scene,&far0);
+          if (near0.hit.geomID != hairID || near0.hit.primID != s*numSegments+(unsigned int)(x*numSegments)) return VerifyApplication::FAILED;
+          if (far0.hit.geomID != lodID || far0.hit.primID != 2*(s/4)+(unsigned int)(2.0f*x)) return VerifyApplication::FAILED;
+
+          /* rays between strands only hit the wider ribbon */
+          if (s%4 == 3) continue;
+          RTCRayHit near1 = makeRay(Vec3fa(x,0.01f*float(s)+0.005f,-2.0f),Vec3fa(0,0,1));
+          RTCRayHit far1  = makeRay(Vec3fa(x,0.01f*float(s)+0.005f,-10.0f),Vec3fa(0,0,1));
+          rtcIntersect1(scene,&near1);
+          rtcIntersect1(scene,&far1);
+          if (near1.hit.geomID != RTC_INVALID_GEOMETRY_ID || far1.hit.geomID != lodID) return VerifyApplication::FAILED;
+          RTCRayHit near2 = makeRay(Vec3fa(x,0.01f*float(s)+0.005f,-2.0f),Vec3fa(0,0,1));
+          RTCRayHit far2  = makeRay(Vec3fa(x,0.01f*float(s)+0.005f,-10.0f),Vec3fa(0,0,1));
+          rtcOccluded1(scene,&near2.ray);
+          rtcOccluded1(scene,&far2.ray);
+          if (near2.ray.tfar < 0.0f || far2.ray.tfar >= 0.0f) return VerifyApplication::FAILED;
+        }
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct CurveRibbonPackedTest : public VerifyApplication::Test
+  {
+    RTCGeometryType gtype;
+    unsigned int tessellationRate;
+
+    CurveRibbonPackedTest (std::string name, int isa, RTCGeometryType gtype, unsigned int tessellationRate)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), gtype(gtype), tessellationRate(tessellationRate) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_CURVE_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* many short crossing curves, such that leaves contain several curves hit by the same ray */
+      const unsigned int numCurves = 256;
+      std::vector<unsigned int> indices(numCurves);
+      std::vector<Vec3ff> vertices(4*numCurves);
+      for (unsigned int i=0; i<numCurves; i++)
+      {
+        indices[i] = 4*i;
+        const Vec3fa p(random_float(),random_float(),random_float());
+        const Vec3fa d(random_float()-0.5f,random_float()-0.5f,random_float()-0.5f);
+        const Vec3fa b(random_float()-0.5f,random_float()-0.5f,random_float()-0.5f);
+        for (unsigned int j=0; j<4; j++) {
+          const float t = float(j)/3.0f-0.5f;
+          vertices[4*i+j] = Vec3ff(p+t*d+0.2f*(0.25f-t*t)*b,0.02f);
+        }
+      }
+
+      /* scene0 stores all curves in a single geometry, scene1 stores each curve in its own geometry */
+      RTCSceneRef scene0 = rtcNewScene(device);
+      RTCSceneRef scene1 = rtcNewScene(device);
+      for (unsigned int i=0; i<=numCurves; i++)
+      {
+        RTCGeometry geom = rtcNewGeometry(device,gtype);
+        const unsigned int first = i == numCurves ? 0 : i;
+        const unsigned int count = i == numCurves ? numCurves : 1;
+        rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT,indices.data(),first*sizeof(unsigned int),sizeof(unsigned int),count);
+        rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT4,vertices.data(),0,sizeof(Vec3ff),vertices.size());
+        rtcSetGeometryTessellationRate(geom,float(tessellationRate));
+        rtcCommitGeometry(geom);
+        rtcAttachGeometry(i == numCurves ? scene0 : scene1,geom);
+        rtcReleaseGeometry(geom);
+      }
+      rtcCommitScene(scene0);
+      rtcCommitScene(scene1);
+      AssertNoError(device);
+
+      for (size_t i=0; i<4096; i++)
+      {
+        const Vec3fa org(2.0f*random_float()-0.5f,2.0f*random_float()-0.5f,-2.0f);
+        const Vec3fa dst(random_float(),random_float(),random_float());
+        RTCRayHit ray0 = makeRay(org,dst-org), ray1 = ray0;
+        rtcIntersect1(scene0,&ray0);
+        rtcIntersect1(scene1,&ray1);
+        const unsigned int curve0 = ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID ? RTC_INVALID_GEOMETRY_ID : ray0.hit.primID;
+        if (curve0 != ray1.hit.geomID) return VerifyApplication::FAILED;
+        if (abs(ray0.ray.tfar-ray1.ray.tfar) > 1E-4f*ray1.ray.tfar) return VerifyApplication::FAILED;
+        if (abs(ray0.hit.u-ray1.hit.u) > 1E-3f) return VerifyApplication::FAILED;
+
+        RTCRayHit ray2 = makeRay(org,dst-org), ray3 = ray2;
+        rtcOccluded1(scene0,&ray2.ray);
+        rtcOccluded1(scene1,&ray3.ray);
+        if ((ray2.ray.tfar < 0.0f) != (ray3.ray.tfar < 0.0f)) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct PointMortonBuildTest : public VerifyApplication::Test
+  {
+    RTCGeometryType gtype;
+
+    PointMortonBuildTest (std::string name, int isa, RTCGeometryType gtype)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), gtype(gtype) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_POINT_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* two interleaved point clouds, some points have a negative radius and are invalid */
+      const size_t numPoints = 4096;
+      std::vector<Vec3ff> vertices[2];
+      std::vector<Vec3fa> normals[2];
+      for (size_t g=0; g<2; g++) {
+        for (size_t i=0; i<numPoints; i++) {
+          const float r = i%97 == 0 ? -1.0f : 0.005f+0.01f*random_float();
+          vertices[g].push_back(Vec3ff(random_float(),random_float(),random_float(),r));
+          normals[g].push_back(normalize(Vec3fa(random_float()-0.5f,random_float()-0.5f,-1.0f)));
+        }
+      }
+
+      /* the low quality build sorts the points on morton codes, the medium quality build uses the SAH */
+      RTCSceneRef scenes[2] = { rtcNewScene(device), rtcNewScene(device) };
+      rtcSetSceneBuildQuality(scenes[0],RTC_BUILD_QUALITY_LOW);
+      rtcSetSceneBuildQuality(scenes[1],RTC_BUILD_QUALITY_MEDIUM);
+      for (size_t s=0; s<2; s++) {
+        for (size_t g=0; g<2; g++) {
+          RTCGeometry geom = rtcNewGeometry(device,gtype);
+          rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT4,vertices[g].data(),0,sizeof(Vec3ff),numPoints);
+          if (gtype == RTC_GEOMETRY_TYPE_ORIENTED_DISC_POINT)
+            rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_NORMAL,0,RTC_FORMAT_FLOAT3,normals[g].data(),0,sizeof(Vec3fa),numPoints);
+          rtcCommitGeometry(geom);
+          rtcAttachGeometry(scenes[s],geom);
+          rtcReleaseGeometry(geom);
+        }
+        rtcCommitScene(scenes[s]);
+      }
+      AssertNoError(device);
+
+      /* both scenes have to produce the same hits */
+      for (size_t i=0; i<4096; i++)
+      {
+        const Vec3fa org(2.0f*random_float()-0.5f,2.0f*random_float()-0.5f,-1.0f);
+        const Vec3fa dst(random_float(),random_float(),random_float());
+        RTCRayHit ray0 = makeRay(org,dst-org), ray1 = ray0;
+        rtcIntersect1(scenes[0],&ray0);
+        rtcIntersect1(scenes[1],&ray1);
+        if (ray0.hit.geomID != ray1.hit.geomID) return VerifyApplication::FAILED;
+        if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (ray0.hit.primID != ray1.hit.primID || ray0.ray.tfar != ray1.ray.tfar) return VerifyApplication::FAILED;
+        if (vertices[ray0.hit.geomID][ray0.hit.primID].w < 0.0f) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct GridHoleTest : public VerifyApplication::Test
+  {
+    GridHoleTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      /* height field with some invalid vertices, the quads touching them are holes */
+      const unsigned int width = 17, height = 12;
+      std::vector<Vec3fa> vertices;
+      for (unsigned int y=0; y<height; y++) {
+        for (unsigned int x=0; x<width; x++) {
+          const Vec3fa p(float(x)/float(width-1),0.1f*sinf(5.0f*float(x+y)/float(width)),float(y)/float(height-1));
+          vertices.push_back(random_int()%16 == 0 ? Vec3fa(nan) : p);
+        }
+      }
+
+      /* the same quads as quad mesh, where quads with invalid vertices get skipped as well */
+      std::vector<unsigned int> indices;
+      for (unsigned int y=0; y<height-1; y++) {
+        for (unsigned int x=0; x<width-1; x++) {
+          const unsigned int v = y*width+x;
+          indices.push_back(v); indices.push_back(v+1); indices.push_back(v+width+1); indices.push_back(v+width);
+        }
+      }
+
+      RTCSceneRef scenes[2] = { rtcNewScene(device), rtcNewScene(device) };
+      RTCGeometry grid = rtcNewGeometry(device,RTC_GEOMETRY_TYPE_GRID);
+      RTCGrid* g = (RTCGrid*) rtcSetNewGeometryBuffer(grid,RTC_BUFFER_TYPE_GRID,0,RTC_FORMAT_GRID,sizeof(RTCGrid),1);
+      g->startVertexID = 0;
+      g->stride = width;
+      g->width = width;
+      g->height = height;
+      rtcSetSharedGeometryBuffer(grid,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT3,vertices.data(),0,sizeof(Vec3fa),vertices.size());
+      rtcCommitGeometry(grid);
+      rtcAttachGeometry(scenes[0],grid);
+      rtcReleaseGeometry(grid);
+
+      RTCGeometry quads = rtcNewGeometry(device,RTC_GEOMETRY_TYPE_QUAD);
+      rtcSetSharedGeometryBuffer(quads,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT4,indices.data(),0,4*sizeof(unsigned int),indices.size()/4);
+      rtcSetSharedGeometryBuffer(quads,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT3,vertices.data(),0,sizeof(Vec3fa),vertices.size());
+      rtcCommitGeometry(quads);
+      rtcAttachGeometry(scenes[1],quads);
+      rtcReleaseGeometry(quads);
+
+      rtcCommitScene(scenes[0]);
+      rtcCommitScene(scenes[1]);
+      AssertNoError(device);
+
+      for (size_t i=0; i<4096; i++)
+      {
+        const Vec3fa org(1.2f*random_float()-0.1f,1.0f,1.2f*random_float()-0.1f);
+        RTCRayHit ray0 = makeRay(org,Vec3fa(0.0f,-1.0f,0.0f)), ray1 = ray0;
+        rtcIntersect1(scenes[0],&ray0);
+        rtcIntersect1(scenes[1],&ray1);
+        if ((ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) != (ray1.hit.geomID == RTC_INVALID_GEOMETRY_ID)) return VerifyApplication::FAILED;
+        if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (abs(ray0.ray.tfar - ray1.ray.tfar) > 1E-4f) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct MotionBlurRefitTest : public VerifyApplication::Test
+  {
+    MotionBlurRefitTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      /* the same motion blurred meshes once in a scene that gets refitted and once in a scene that gets rebuilt */
+      Ref<SceneGraph::TriangleMeshNode> tris = SceneGraph::createTriangleSphere(Vec3fa(-1,0,0),1.0f,50)->set_motion_vector(random_motion_vector(1.0f)).dynamicCast<SceneGraph::TriangleMeshNode>();
+      Ref<SceneGraph::QuadMeshNode> quads = SceneGraph::createQuadSphere(Vec3fa(+1,0,0),1.0f,30)->set_motion_vector(random_motion_vector(1.0f)).dynamicCast<SceneGraph::QuadMeshNode>();
+
+      VerifyScene scene0(device,SceneFlags(RTC_SCENE_FLAG_DYNAMIC,RTC_BUILD_QUALITY_LOW));
+      VerifyScene scene1(device,SceneFlags(RTC_SCENE_FLAG_DYNAMIC,RTC_BUILD_QUALITY_LOW));
+      RTCGeometry geoms[4] = {
+        rtcGetGeometry(scene0,scene0.addGeometry(RTC_BUILD_QUALITY_REFIT, tris.dynamicCast<SceneGraph::Node>())),
+        rtcGetGeometry(scene0,scene0.addGeometry(RTC_BUILD_QUALITY_REFIT, quads.dynamicCast<SceneGraph::Node>())),
+        rtcGetGeometry(scene1,scene1.addGeometry(RTC_BUILD_QUALITY_MEDIUM,tris.dynamicCast<SceneGraph::Node>())),
+        rtcGetGeometry(scene1,scene1.addGeometry(RTC_BUILD_QUALITY_MEDIUM,quads.dynamicCast<SceneGraph::Node>()))
+      };
+      AssertNoError(device);
+
+      for (size_t frame=0; frame<8; frame++)
+      {
+        /* deform all time steps of the meshes after the first frame */
+        if (frame > 0)
+        {
+          const Vec3fa ds = 0.5f*random_Vec3fa()-Vec3fa(0.25f);
+          for (size_t t=0; t<tris->numTimeSteps(); t++)
+            for (auto& p : tris->positions[t]) p += ds+0.1f*random_Vec3fa();
+          for (size_t t=0; t<quads->numTimeSteps(); t++)
+            for (auto& p : quads->positions[t]) p += ds+0.1f*random_Vec3fa();
+
+          for (size_t i=0; i<4; i++)
+          {
+            const size_t numTimeSteps = (i%2) ? quads->numTimeSteps() : tris->numTimeSteps();
+            for (unsigned int t=0; t<numTimeSteps; t++)
+              rtcUpdateGeometryBuffer(geoms[i],RTC_BUFFER_TYPE_VERTEX,t);
+            rtcCommitGeometry(geoms[i]);
+          }
+        }
+        rtcCommitScene(scene0);
+        rtcCommitScene(scene1);
+        AssertNoError(device);
+
+        for (size_t i=0; i<1024; i++)
+        {
+          const Vec3fa org = 8.0f*random_Vec3fa()-Vec3fa(4.0f);
+          const Vec3fa dir = 2.0f*random_Vec3fa()-Vec3fa(1.0f)-org;
+          RTCRayHit ray0 = makeRay(org,dir), ray1;
+          ray0.ray.time = random_float();
+          ray1 = ray0;
+          rtcIntersect1(scene0,&ray0);
+          rtcIntersect1(scene1,&ray1);
+          if (ray0.hit.geomID != ray1.hit.geomID) return VerifyApplication::FAILED;
+          if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+          if (abs(ray0.ray.tfar - ray1.ray.tfar) > 1E-4f) return VerifyApplication::FAILED;
+        }
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct CubicInstanceMotionTest : public VerifyApplication::Test
+  {
+    CubicInstanceMotionTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      /* small off-center sphere whose curved motion is not bounded by linearly blended bounds */
+      VerifyScene bl_scene(device,SceneFlags(RTC_SCENE_FLAG_NONE,RTC_BUILD_QUALITY_MEDIUM));
+      bl_scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createTriangleSphere(Vec3fa(1.0f,0.0f,0.0f),0.2f,16));
+      rtcCommitScene(bl_scene);
+      AssertNoError(device);
+
+      const unsigned int numInstances = 16, numTimeSteps = 4;
+      std::vector<std::vector<AffineSpace3fa>> transforms(numTimeSteps,std::vector<AffineSpace3fa>(numInstances));
+      for (unsigned int i=0; i<numInstances; i++)
+      {
+        /* the instances circle around a center with a quarter turn per time step */
+        const Vec3fa axis = normalize(2.0f*random_Vec3fa()-Vec3fa(1.0f));
+        const Vec3fa center = 8.0f*random_Vec3fa()-Vec3fa(4.0f);
+        for (unsigned int t=0; t<numTimeSteps; t++)
+          transforms[t][i] = AffineSpace3fa::translate(center) * AffineSpace3fa::rotate(axis,0.5f*float(pi)*float(t)) * AffineSpace3fa::translate(Vec3fa(2.0f,0.0f,0.0f));
+      }
+
+      RTCSceneRef scene0 = rtcNewScene(device);
+      RTCGeometry instances[numInstances];
+      for (unsigned int i=0; i<numInstances; i++)
+      {
+        instances[i] = rtcNewGeometry(device,RTC_GEOMETRY_TYPE_INSTANCE);
+        rtcSetGeometryTimeStepCount(instances[i],numTimeSteps);
+        rtcSetGeometryTransformInterpolation(instances[i],RTC_TRANSFORM_INTERPOLATION_CUBIC);
+        for (unsigned int t=0; t<numTimeSteps; t++)
+          rtcSetGeometryTransform(instances[i],t,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,(float*)&transforms[t][i]);
+        rtcSetGeometryInstancedScene(instances[i],bl_scene);
+        rtcCommitGeometry(instances[i]);
+        rtcAttachGeometry(scene0,instances[i]);
+        rtcReleaseGeometry(instances[i]);
+      }
+      rtcCommitScene(scene0);
+
+      RTCSceneRef scene1 = rtcNewScene(device);
+      RTCGeometry instance_array = rtcNewGeometry(device,RTC_GEOMETRY_TYPE_INSTANCE_ARRAY);
+      rtcSetGeometryTimeStepCount(instance_array,numTimeSteps);
+      rtcSetGeometryTransformInterpolation(instance_array,RTC_TRANSFORM_INTERPOLATION_CUBIC);
+      for (unsigned int t=0; t<numTimeSteps; t++)
+        rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM,t,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,transforms[t].data(),0,sizeof(AffineSpace3fa),numInstances);
+      rtcSetGeometryInstancedScene(instance_array,bl_scene);
+      rtcCommitGeometry(instance_array);
+      rtcAttachGeometry(scene1,instance_array);
+      rtcReleaseGeometry(instance_array);
+      rtcCommitScene(scene1);
+      AssertNoError(device);
+
+      /* the spline has to pass through the transformations of the time steps */
+      for (unsigned int t=0; t<numTimeSteps; t++)
+      {
+        AffineSpace3fa xfm0, xfm1;
+        rtcGetGeometryTransform(instances[0],float(t)/float(numTimeSteps-1),RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,&xfm0);
+        rtcGetGeometryTransformEx(instance_array,0,float(t)/float(numTimeSteps-1),RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,&xfm1);
+        if (reduce_max(abs(xfm0.p-transforms[t][0].p)) > 1E-4f) return VerifyApplication::FAILED;
+        if (reduce_max(abs(xfm0.l.vx-transforms[t][0].l.vx)) > 1E-4f) return VerifyApplication::FAILED;
+        if (reduce_max(abs(xfm1.p-transforms[t][0].p)) > 1E-4f) return VerifyApplication::FAILED;
+        if (reduce_max(abs(xfm1.l.vx-transforms[t][0].l.vx)) > 1E-4f) return VerifyApplication::FAILED;
+      }
+
+      /* rays have to find the same hits as when intersecting each instance with its interpolated transformation,
+       * which fails if the bounds do not enclose the curved motion of the instances */
+      for (size_t i=0; i<4096; i++)
+      {
+        const unsigned int target = min((unsigned int)(numInstances*random_float()),numInstances-1);
+        const float time = random_float();
+        AffineSpace3fa xfm;
+        rtcGetGeometryTransform(instances[target],time,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,&xfm);
+        const Vec3fa org = 16.0f*random_Vec3fa()-Vec3fa(8.0f);
+        const Vec3fa dir = xfmPoint(xfm,Vec3fa(1.0f,0.0f,0.0f)) + 0.5f*random_Vec3fa()-Vec3fa(0.25f) - org;
+
+        float tfar = inf; unsigned int instID = RTC_INVALID_GEOMETRY_ID;
+        for (unsigned int j=0; j<numInstances; j++)
+        {
+          AffineSpace3fa local2world;
+          rtcGetGeometryTransform(instances[j],time,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,&local2world);
+          const AffineSpace3fa world2local = rcp(local2world);
+          RTCRayHit ray = makeRay(xfmPoint(world2local,org),xfmVector(world2local,dir));
+          rtcIntersect1(bl_scene,&ray);
+          if (ray.hit.geomID != RTC_INVALID_GEOMETRY_ID && ray.ray.tfar < tfar) {
+            tfar = ray.ray.tfar; instID = j;
+          }
+        }
+
+        RTCRayHit ray0 = makeRay(org,dir); ray0.ray.time = time;
+        RTCRayHit ray1 = ray0;
+        rtcIntersect1(scene0,&ray0);
+        rtcIntersect1(scene1,&ray1);
+        if (ray0.hit.instID[0] != instID || ray1.hit.instPrimID[0] != (instID == RTC_INVALID_GEOMETRY_ID ? RTC_INVALID_GEOMETRY_ID : instID))
+          return VerifyApplication::FAILED;
+        if (instID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (abs(ray0.ray.tfar-tfar) > 1E-4f*tfar || abs(ray1.ray.tfar-tfar) > 1E-4f*tfar)
+          return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct BatchSpheres
+  {
+    BatchSpheres () : numCalls(0), numBatchCalls(0), numMultiPrimBatches(0) {}
+    avector<Sphere> spheres;
+    std::atomic<size_t> numCalls;
+    std::atomic<size_t> numBatchCalls;
+    std::atomic<size_t> numMultiPrimBatches;
+  };
+
+  void BatchSphereBoundsFunc(const struct RTCBoundsFunctionArguments* const args)
+  {
+    BatchSpheres* data = (BatchSpheres*) args->geometryUserPtr;
+    *(BBox3fa*)args->bounds_o = data->spheres[args->primID].bounds();
+  }
+
+  bool intersectBatchSphere(const Sphere& sphere, RTCRayN* ray, unsigned int N, unsigned int i, float& t)
+  {
+    const Vec3fa org(RTCRayN_org_x(ray,N,i),RTCRayN_org_y(ray,N,i),RTCRayN_org_z(ray,N,i));
+    const Vec3fa dir(RTCRayN_dir_x(ray,N,i),RTCRayN_dir_y(ray,N,i),RTCRayN_dir_z(ray,N,i));
+    const Vec3fa v = org-sphere.pos;
+    const float A = dot(dir,dir);
+    const float B = 2.0f*dot(v,dir);
+    const float C = dot(v,v) - sqr(sphere.r);
+    const float D = B*B - 4.0f*A*C;
+    if (D < 0.0f) return false;
+    const float Q = sqrt(D);
+    const float t0 = (-B-Q)/(2.0f*A);
+    const float t1 = (-B+Q)/(2.0f*A);
+    const float tnear = RTCRayN_tnear(ray,N,i);
+    const float tfar = RTCRayN_tfar(ray,N,i);
+    if      (tnear <= t0 && t0 < tfar) t = t0;
+    else if (tnear <= t1 && t1 < tfar) t = t1;
+    else return false;
+    return true;
+  }
+
+  void intersectBatchSpheres(const int* valid, BatchSpheres* data, RTCRayQueryContext* context, RTCRayHitN* rayhit, unsigned int N, unsigned int geomID, const unsigned int* primIDs, unsigned int numPrims)
+  {
+    RTCRayN* ray = RTCRayHitN_RayN(rayhit,N);
+    RTCHitN* hit = RTCRayHitN_HitN(rayhit,N);
+    for (unsigned int i=0; i<N; i++)
+    {
+      if (!valid[i]) continue;
+      for (unsigned int j=0; j<numPrims; j++)
+      {
+        float t;
+        const Sphere& sphere = data->spheres[primIDs[j]];
+        if (!intersectBatchSphere(sphere,ray,N,i,t)) continue;
+        const Vec3fa org(RTCRayN_org_x(ray,N,i),RTCRayN_org_y(ray,N,i),RTCRayN_org_z(ray,N,i));
+        const Vec3fa dir(RTCRayN_dir_x(ray,N,i),RTCRayN_dir_y(ray,N,i),RTCRayN_dir_z(ray,N,i));
+        const Vec3fa Ng = org+t*dir-sphere.pos;
+        RTCRayN_tfar(ray,N,i) = t;
+        RTCHitN_Ng_x(hit,N,i) = Ng.x;
+        RTCHitN_Ng_y(hit,N,i) = Ng.y;
+        RTCHitN_Ng_z(hit,N,i) = Ng.z;
+        RTCHitN_u(hit,N,i) = 0.0f;
+        RTCHitN_v(hit,N,i) = 0.0f;
+        RTCHitN_primID(hit,N,i) = primIDs[j];
+        RTCHitN_geomID(hit,N,i) = geomID;
+        RTCHitN_instID(hit,N,i,0) = context->instID[0];
+      }
+    }
+  }
+
+  void occludedBatchSpheres(const int* valid, BatchSpheres* data, RTCRayN* ray, unsigned int N, const unsigned int* primIDs, unsigned int numPrims)
+  {
+    for (unsigned int i=0; i<N; i++)
+    {
+      if (!valid[i]) continue;
+      for (unsigned int j=0; j<numPrims; j++)
+      {
+        float t;
+        if (!intersectBatchSphere(data->spheres[primIDs[j]],ray,N,i,t)) continue;
+        RTCRayN_tfar(ray,N,i) = neg_inf;
+        break;
+      }
+    }
+  }
+
+  void BatchSphereIntersectFuncN(const struct RTCIntersectFunctionNArguments* const args)
+  {
+    BatchSpheres* data = (BatchSpheres*) args->geometryUserPtr;
+    data->numCalls++;
+    intersectBatchSpheres(args->valid,data,args->context,args->rayhit,args->N,args->geomID,&args->primID,1);
+  }
+
+  void BatchSphereOccludedFuncN(const struct RTCOccludedFunctionNArguments* const args)
+  {
+    BatchSpheres* data = (BatchSpheres*) args->geometryUserPtr;
+    data->numCalls++;
+    occludedBatchSpheres(args->valid,data,args->ray,args->N,&args->primID,1);
+  }
+
+  void BatchSphereIntersectFuncBatch(const struct RTCIntersectFunctionBatchArguments* const args)
+  {
+    BatchSpheres* data = (BatchSpheres*) args->geometryUserPtr;
+    data->numBatchCalls++;
+    if (args->numPrims > 1) data->numMultiPrimBatches++;
+    intersectBatchSpheres(args->valid,data,args->context,args->rayhit,args->N,args->geomID,args->primIDs,args->numPrims);
+  }
+
+  void BatchSphereOccludedFuncBatch(const struct RTCOccludedFunctionBatchArguments* const args)
+  {
+    BatchSpheres* data = (BatchSpheres*) args->geometryUserPtr;
+    data->numBatchCalls++;
+    if (args->numPrims > 1) data->numMultiPrimBatches++;
+    occludedBatchSpheres(args->valid,data,args->ray,args->N,args->primIDs,args->numPrims);
+  }
+
+  struct UserGeometryBatchTest : public VerifyApplication::Test
+  {
+    UserGeometryBatchTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    RTCScene createScene(RTCDevice device, BatchSpheres& data, bool batched)
+    {
+      RTCScene scene = rtcNewScene(device);
+      RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_USER);
+      rtcSetGeometryUserPrimitiveCount(geom,(unsigned int)data.spheres.size());
+      rtcSetGeometryUserData(geom,&data);
+      rtcSetGeometryBoundsFunction(geom,BatchSphereBoundsFunc,nullptr);
+      rtcSetGeometryIntersectFunction(geom,BatchSphereIntersectFuncN);
+      rtcSetGeometryOccludedFunction(geom,BatchSphereOccludedFuncN);
+      if (batched) {
+        rtcSetGeometryIntersectFunctionBatch(geom,BatchSphereIntersectFuncBatch);
+        rtcSetGeometryOccludedFunctionBatch(geom,BatchSphereOccludedFuncBatch);
+      }
+      rtcCommitGeometry(geom);
+      rtcAttachGeometry(scene,geom);
+      rtcReleaseGeometry(geom);
+      rtcCommitScene(scene);
+      return scene;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      /* larger leaves let a single callback process several primitives */
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa)+",object_accel_max_leaf_size=7";
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      BatchSpheres data0, data1;
+      for (size_t i=0; i<256; i++) {
+        const Sphere sphere(random_Vec3fa(),0.02f+0.05f*random_float());
+        data0.spheres.push_back(sphere);
+        data1.spheres.push_back(sphere);
+      }
+      RTCScene scene0 = createScene(device,data0,false);
+      RTCScene scene1 = createScene(device,data1,true);
+      AssertNoError(device);
+
+      const IntersectMode imodes[] = { MODE_INTERSECT1, MODE_INTERSECT4 };
+      const IntersectVariant ivariants[] = { VARIANT_INTERSECT, VARIANT_OCCLUDED };
+      bool passed = true;
+      for (IntersectMode imode : imodes)
+      {
+        for (IntersectVariant ivariant : ivariants)
+        {
+          RTCRayHit rays0[256], rays1[256];
+          for (size_t i=0; i<256; i++) {
+            const Vec3fa org = 2.0f*random_Vec3fa()-Vec3fa(0.5f);
+            const Vec3fa dst = random_Vec3fa();
+            rays0[i] = rays1[i] = makeRay(org,dst-org);
+          }
+          IntersectWithMode(imode,ivariant,scene0,rays0,256);
+          IntersectWithMode(imode,ivariant,scene1,rays1,256);
+
+          for (size_t i=0; i<256; i++)
+          {
+            passed &= rays0[i].ray.tfar == rays1[i].ray.tfar;
+            if (ivariant & VARIANT_INTERSECT) {
+              passed &= rays0[i].hit.geomID == rays1[i].hit.geomID;
+              passed &= rays0[i].hit.primID == rays1[i].hit.primID;
+            }
+          }
+        }
+      }
+
+      /* the batched scene must not fall back to per-primitive callbacks */
+      passed &= data1.numCalls == 0;
+      passed &= data1.numBatchCalls > 0;
+      passed &= data1.numMultiPrimBatches > 0;
+
+      rtcReleaseScene(scene0);
+      rtcReleaseScene(scene1);
+      AssertNoError(device);
+      return passed ? VerifyApplication::PASSED : VerifyApplication::FAILED;
+    }
+  };
+
+  struct AlphaMaskTest : public VerifyApplication::Test
+  {
+    RTCGeometryType gtype;
+    RTCAlphaMaskFormat format;
+
+    AlphaMaskTest (std::string name, int isa, RTCGeometryType gtype, RTCAlphaMaskFormat format)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), gtype(gtype), format(format) {}
+
+    unsigned int addPlane(RTCDevice device, RTCScene scene, RTCGeometryType type, float z)
+    {
+      RTCGeometry geom = rtcNewGeometry(device, type);
+      Vec3f* vertices = (Vec3f*) rtcSetNewGeometryBuffer(geom,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT3,sizeof(Vec3f),4);
+      vertices[0] = Vec3f(0.0f,0.0f,z); vertices[1] = Vec3f(1.0f,0.0f,z);
+      vertices[2] = Vec3f(1.0f,1.0f,z); vertices[3] = Vec3f(0.0f,1.0f,z);
+      if (type == RTC_GEOMETRY_TYPE_TRIANGLE) {
+        unsigned int* indices = (unsigned int*) rtcSetNewGeometryBuffer(geom,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT3,3*sizeof(unsigned int),2);
+        indices[0] = 0; indices[1] = 1; indices[2] = 2;
+        indices[3] = 0; indices[4] = 2; indices[5] = 3;
+      } else {
+        unsigned int* indices = (unsigned int*) rtcSetNewGeometryBuffer(geom,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT4,4*sizeof(unsigned int),1);
+        for (unsigned int i=0; i<4; i++) indices[i] = i;
+      }
+      rtcSetGeometryVertexAttributeCount(geom,1);
+      Vec2f* uvs = (Vec2f*) rtcSetNewGeometryBuffer(geom,RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE,0,RTC_FORMAT_FLOAT2,sizeof(Vec2f),4);
+      for (unsigned int i=0; i<4; i++) uvs[i] = Vec2f(vertices[i].x,vertices[i].y);
+      unsigned int geomID = rtcAttachGeometry(scene,geom);
+      rtcReleaseGeometry(geom);
+      return geomID;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      /* random 8x8 mask on the front plane, opaque plane behind it */
+      const unsigned int size = 8;
+      bool opaque[size*size];
+      std::vector<unsigned char> texels(format == RTC_ALPHA_MASK_FORMAT_BIT ? size*size/8 : size*size, 0);
+      for (unsigned int i=0; i<size*size; i++)
+      {
+        if (format == RTC_ALPHA_MASK_FORMAT_BIT) {
+          opaque[i] = random_float() < 0.5f;
+          if (opaque[i]) texels[i/8] |= 1 << (i%8);
+        } else {
+          texels[i] = (unsigned char) (random_int() & 0xFF);
+          opaque[i] = texels[i] >= 128;
+        }
+      }
+
+      RTCSceneRef scene = rtcNewScene(device);
+      const unsigned int front = addPlane(device,scene,gtype,0.0f);
+      const unsigned int back  = addPlane(device,scene,gtype,-1.0f);
+      RTCGeometry geom = rtcGetGeometry(scene,front);
+      rtcSetGeometryAlphaMask(geom,format,texels.data(),size,size,0,0.5f);
+      rtcCommitGeometry(geom);
+      rtcCommitGeometry(rtcGetGeometry(scene,back));
+      rtcCommitScene(scene);
+      AssertNoError(device);
+
+      const IntersectMode imodes[] = { MODE_INTERSECT1, MODE_INTERSECT4 };
+      const IntersectVariant ivariants[] = { VARIANT_INTERSECT, VARIANT_OCCLUDED };
+      for (IntersectMode imode : imodes)
+      {
+        for (IntersectVariant ivariant : ivariants)
+        {
+          /* occlusion rays end between both planes */
+          const float tfar = (ivariant & VARIANT_INTERSECT) ? float(inf) : 1.5f;
+          unsigned int texel[256];
+          RTCRayHit rays[256];
+          for (size_t i=0; i<256; i++)
+          {
+            const unsigned int x = random_int() % size;
+            const unsigned int y = random_int() % size;
+            texel[i] = y*size+x;
+            const float fx = (float(x)+0.1f+0.8f*random_float())/float(size);
+            const float fy = (float(y)+0.1f+0.8f*random_float())/float(size);
+            rays[i] = makeRay(Vec3fa(fx,fy,1.0f),Vec3fa(0.0f,0.0f,-1.0f),0.0f,tfar);
+          }
+          IntersectWithMode(imode,ivariant,scene,rays,256);
+
+          for (size_t i=0; i<256; i++)
+          {
+            if (ivariant & VARIANT_INTERSECT) {
+              if (rays[i].hit.geomID != (opaque[texel[i]] ? front : back))
+                return VerifyApplication::FAILED;
+            } else {
+              if ((rays[i].ray.tfar < 0.0f) != opaque[texel[i]])
+                return VerifyApplication::FAILED;
+            }
+          }
+        }
+      }
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct CurveSplitBuildTest : public VerifyApplication::Test
+  {
+    RTCGeometryType gtype;
+
+    CurveSplitBuildTest (std::string name, int isa, RTCGeometryType gtype)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), gtype(gtype) {}
+
+    RTCScene createScene(RTCDevice device, RTCBuildQuality quality, const std::vector<unsigned int>& indices, const std::vector<Vec3ff>& vertices)
+    {
+      RTCScene scene = rtcNewScene(device);
+      rtcSetSceneBuildQuality(scene,quality);
+      RTCGeometry geom = rtcNewGeometry(device,gtype);
+      rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_INDEX,0,RTC_FORMAT_UINT,indices.data(),0,sizeof(unsigned int),indices.size());
+      rtcSetSharedGeometryBuffer(geom,RTC_BUFFER_TYPE_VERTEX,0,RTC_FORMAT_FLOAT4,vertices.data(),0,sizeof(Vec3ff),vertices.size());
+      rtcCommitGeometry(geom);
+      rtcAttachGeometry(scene,geom);
+      rtcReleaseGeometry(geom);
+      rtcCommitScene(scene);
+      return scene;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_CURVE_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      /* strongly curled strands whose segments get split by high quality builds */
+      const bool bezier = gtype == RTC_GEOMETRY_TYPE_ROUND_BEZIER_CURVE || gtype == RTC_GEOMETRY_TYPE_FLAT_BEZIER_CURVE;
+      const unsigned int numStrands = 64, numSegments = 16, vertexStride = bezier ? 3 : 1;
+      const unsigned int numVertices = bezier ? 3*numSegments+1 : numSegments+3;
+      std::vector<unsigned int> indices;
+      std::vector<Vec3ff> vertices;
+      for (unsigned int s=0; s<numStrands; s++)
+      {
+        const Vec3fa root(2.0f*random_float()-1.0f,0.0f,2.0f*random_float()-1.0f);
+        for (unsigned int j=0; j<numSegments; j++)
+          indices.push_back((unsigned int)vertices.size()+j*vertexStride);
+        for (unsigned int j=0; j<numVertices; j++) {
+          const float t = float(j)/float(numVertices-1);
+          const float phi = 6.0f*float(pi)*t + float(s);
+          vertices.push_back(Vec3ff(root+Vec3fa(0.1f*cosf(phi),t,0.1f*sinf(phi)),0.005f));
+        }
+      }
+
+      RTCSceneRef scene0 = createScene(device,RTC_BUILD_QUALITY_MEDIUM,indices,vertices);
+      RTCSceneRef scene1 = createScene(device,RTC_BUILD_QUALITY_HIGH,indices,vertices);
+      AssertNoError(device);
+
+      /* both scenes have to produce the same hits */
+      for (size_t i=0; i<4096; i++)
       {
-        u[i] = random_float(); 
-        v[i] = random_float();
-        Vec3fa from(0.0f,0.0f,-1.0f);
-        Vec3fa to = uniformSampleTriangle(vertices[1],vertices[2],vertices[0],u[i],v[i]);
-        rays[i] = makeRay(from,to-from);
+        const Vec3fa org(4.0f*random_float()-2.0f,4.0f*random_float()-1.5f,-3.0f);
+        const Vec3fa dst(2.2f*random_float()-1.1f,1.2f*random_float()-0.1f,2.2f*random_float()-1.1f);
+        RTCRayHit ray0 = makeRay(org,dst-org), ray1 = ray0;
+        rtcIntersect1(scene0,&ray0);
+        rtcIntersect1(scene1,&ray1);
+        if (ray0.hit.geomID != ray1.hit.geomID) return VerifyApplication::FAILED;
+        if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (abs(ray0.ray.tfar - ray1.ray.tfar) > 1E-4f*ray0.ray.tfar) return VerifyApplication::FAILED;
       }
-      IntersectWithMode(imode,ivariant,scene,rays,256);
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
 
-      for (size_t i=0; i<256; i++)
+  struct SubdivTopologyUpdateTest : public VerifyApplication::Test
+  {
+    SubdivTopologyUpdateTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    RTCGeometry createGeometry(RTCDevice device, const Ref<SceneGraph::SubdivMeshNode>& mesh, std::vector<unsigned int>& indices)
+    {
+      RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SUBDIVISION);
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3, mesh->positions[0].data(), 0, sizeof(SceneGraph::SubdivMeshNode::Vertex), mesh->positions[0].size());
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX,  0, RTC_FORMAT_UINT,   indices.data(), 0, sizeof(unsigned int), indices.size());
+      rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_FACE,   0, RTC_FORMAT_UINT,   mesh->verticesPerFace.data(), 0, sizeof(unsigned int), mesh->verticesPerFace.size());
+      rtcCommitGeometry(geom);
+      return geom;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      if (!rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_SUBDIVISION_GEOMETRY_SUPPORTED))
+        return VerifyApplication::SKIPPED;
+
+      RandomSampler sampler;
+      RandomSampler_init(sampler,0);
+      Ref<SceneGraph::SubdivMeshNode> mesh = SceneGraph::createSubdivSphere(zero,1.0f,8,16).dynamicCast<SceneGraph::SubdivMeshNode>();
+      const std::vector<unsigned int> original = mesh->position_indices;
+      std::vector<unsigned int> indices = original;
+      std::vector<unsigned int> faceStart(mesh->verticesPerFace.size());
+      for (size_t f=0, ofs=0; f<faceStart.size(); ofs+=mesh->verticesPerFace[f++])
+        faceStart[f] = (unsigned int) ofs;
+      const unsigned int numVertices = (unsigned int) mesh->positions[0].size();
+
+      RTCSceneRef scene0 = rtcNewScene(device);
+      RTCGeometry geom0 = createGeometry(device,mesh,indices);
+      rtcAttachGeometry(scene0,geom0);
+      rtcCommitScene(scene0);
+      AssertNoError(device);
+
+      for (size_t round=0; round<16; round++)
       {
-        
-        if (!(ivariant & VARIANT_INTERSECT)) 
+        /* edits the index buffer of some faces and marks only these ranges as modified */
+        const size_t numEdits = 1 + (round % 4);
+        for (size_t i=0; i<numEdits; i++)
         {
-          if (rays[i].ray.tfar != float(neg_inf)) return VerifyApplication::FAILED;          
-          continue;
+          const unsigned int f = RandomSampler_getUInt(sampler) % faceStart.size();
+          unsigned int* face = indices.data() + faceStart[f];
+          const unsigned int N = mesh->verticesPerFace[f];
+          if (round == 15) {
+            for (unsigned int j=0; j<N; j++) face[j] = original[faceStart[f]+j];
+          }
+          else switch (RandomSampler_getUInt(sampler) % 3) {
+          case 0: std::reverse(face,face+N); break;
+          case 1: std::rotate(face,face+1,face+N); break;
+          case 2: {
+            const unsigned int v = RandomSampler_getUInt(sampler) % numVertices;
+            if (std::find(face,face+N,v) == face+N) face[RandomSampler_getUInt(sampler) % N] = v;
+            break;
+          }
+          }
+          rtcUpdateGeometryBufferRange(geom0, RTC_BUFFER_TYPE_INDEX, 0, faceStart[f], N);
         }
+        rtcCommitGeometry(geom0);
+        rtcCommitScene(scene0);
+        AssertNoError(device);
 
+        /* the incrementally updated mesh has to match a mesh created from scratch */
+        RTCSceneRef scene1 = rtcNewScene(device);
+        RTCGeometry geom1 = createGeometry(device,mesh,indices);
+        rtcAttachGeometry(scene1,geom1);
+        rtcCommitScene(scene1);
+        AssertNoError(device);
 
-        if (rays[i].hit.geomID != 0) return VerifyApplication::FAILED;
-        if (rays[i].hit.primID != 0) return VerifyApplication::FAILED;
-        if (abs(rays[i].hit.u - u[i]) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
-        if (abs(rays[i].hit.v - v[i]) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
-        if (abs(rays[i].ray.tfar - 1.0f) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
-        const Vec3fa org(rays[i].ray.org_x,rays[i].ray.org_y,rays[i].ray.org_z);
-        const Vec3fa dir(rays[i].ray.dir_x,rays[i].ray.dir_y,rays[i].ray.dir_z);
-        const Vec3fa ht  = org + rays[i].ray.tfar*dir;
-        const Vec3fa huv = vertices[0] + rays[i].hit.u*(vertices[1]-vertices[0]) + rays[i].hit.v*(vertices[2]-vertices[0]);
-        if (reduce_max(abs(ht-huv)) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
-        const Vec3fa Ng = Vec3fa(rays[i].hit.Ng_x,rays[i].hit.Ng_y,rays[i].hit.Ng_z);
-        if (reduce_max(abs(Ng - Vec3fa(0.0f,0.0f,1.0f))) > 16.0f*float(ulp)) return VerifyApplication::FAILED;
-      }
-      AssertNoError(device);
+        for (unsigned int e=0; e<(unsigned int)indices.size(); e++)
+          if (rtcGetGeometryOppositeHalfEdge(geom0,0,e) != rtcGetGeometryOppositeHalfEdge(geom1,0,e)) {
+            rtcReleaseGeometry(geom1);
+            rtcReleaseGeometry(geom0);
+            return VerifyApplication::FAILED;
+          }
+        rtcReleaseGeometry(geom1);
 
+        for (size_t i=0; i<64; i++)
+        {
+          const Vec3fa org = 3.0f*normalize(Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f));
+          const Vec3fa dst = 0.5f*Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f);
+          RTCRayHit ray0 = makeRay(org,dst-org), ray1 = ray0;
+          rtcIntersect1(scene0,&ray0);
+          rtcIntersect1(scene1,&ray1);
+          if (ray0.hit.geomID != ray1.hit.geomID || ray0.hit.primID != ray1.hit.primID || ray0.ray.tfar != ray1.ray.tfar) {
+            rtcReleaseGeometry(geom0);
+            return VerifyApplication::FAILED;
+          }
+        }
+        AssertNoError(device);
+      }
+      rtcReleaseGeometry(geom0);
       return VerifyApplication::PASSED;
     }
   };
@@ -3492,6 +4676,118 @@ namespace embree
     }
   };
 
+  struct InstanceArrayCompressedTest : public VerifyApplication::Test
+  {
+    RTCFormat format;
+
+    InstanceArrayCompressedTest (std::string name, int isa, RTCFormat format)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), format(format) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      VerifyScene bl_scene(device,SceneFlags(RTC_SCENE_FLAG_NONE,RTC_BUILD_QUALITY_MEDIUM));
+      bl_scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createTriangleSphere(Vec3fa(0.0f),0.4f,16));
+      rtcCommitScene(bl_scene);
+      AssertNoError(device);
+
+      std::vector<AffineSpace3f> palette(8);
+      for (auto& xfm : palette)
+        xfm = AffineSpace3f(LinearSpace3f::rotate(normalize(Vec3f(random_Vec3fa())+Vec3f(0.1f)),2.0f*float(pi)*random_float()) * LinearSpace3f::scale(Vec3f(0.5f+random_float())));
+
+      for (unsigned int numTimeSteps = 1; numTimeSteps <= 2; numTimeSteps++)
+      {
+        /* the compressed transformations and the transformations they decode to */
+        const unsigned int numInstances = 256;
+        std::vector<std::vector<Vec3f>> translations(numTimeSteps,std::vector<Vec3f>(numInstances));
+        std::vector<std::vector<Vec4f>> translationIndices(numTimeSteps,std::vector<Vec4f>(numInstances));
+        std::vector<std::vector<unsigned short>> halfs(numTimeSteps,std::vector<unsigned short>(12*numInstances));
+        std::vector<std::vector<AffineSpace3fa>> reference(numTimeSteps,std::vector<AffineSpace3fa>(numInstances));
+        for (unsigned int i=0; i<numInstances; i++)
+        {
+          const unsigned int index = min((unsigned int)(palette.size()*random_float()),(unsigned int)palette.size()-1);
+          const Vec3f p = Vec3f(16.0f*random_Vec3fa()-Vec3fa(8.0f));
+          for (unsigned int t=0; t<numTimeSteps; t++)
+          {
+            const Vec3f pt = p + float(t)*Vec3f(random_Vec3fa());
+            translations[t][i] = pt;
+            translationIndices[t][i] = Vec4f(pt.x,pt.y,pt.z,0.0f);
+            ((unsigned int*)&translationIndices[t][i])[3] = index;
+            if (format == RTC_FORMAT_TRANSLATION_FLOAT3)
+              reference[t][i] = AffineSpace3fa::translate(Vec3fa(pt));
+            else if (format == RTC_FORMAT_TRANSLATION_PALETTE_INDEX)
+              reference[t][i] = AffineSpace3fa(LinearSpace3fa(palette[index].l),Vec3fa(palette[index].p+pt));
+            else
+            {
+              AffineSpace3f xfm(palette[index].l,palette[index].p+pt);
+              float* values = (float*) &xfm;
+              for (size_t k=0; k<12; k++)
+                values[k] = half2float(halfs[t][12*i+k] = float2half(values[k]));
+              reference[t][i] = AffineSpace3fa(xfm);
+            }
+          }
+        }
+
+        auto createScene = [&] (bool compressed) -> RTCScene
+        {
+          RTCScene scene = rtcNewScene(device);
+          RTCGeometry instance_array = rtcNewGeometry(device,RTC_GEOMETRY_TYPE_INSTANCE_ARRAY);
+          rtcSetGeometryTimeStepCount(instance_array,numTimeSteps);
+          for (unsigned int t=0; t<numTimeSteps; t++)
+          {
+            if (!compressed)
+              rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM,t,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,reference[t].data(),0,sizeof(AffineSpace3fa),numInstances);
+            else if (format == RTC_FORMAT_TRANSLATION_FLOAT3)
+              rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM,t,format,translations[t].data(),0,sizeof(Vec3f),numInstances);
+            else if (format == RTC_FORMAT_TRANSLATION_PALETTE_INDEX)
+              rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM,t,format,translationIndices[t].data(),0,sizeof(Vec4f),numInstances);
+            else
+              rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM,t,format,halfs[t].data(),0,12*sizeof(unsigned short),numInstances);
+          }
+          if (compressed && format == RTC_FORMAT_TRANSLATION_PALETTE_INDEX)
+            rtcSetSharedGeometryBuffer(instance_array,RTC_BUFFER_TYPE_TRANSFORM_PALETTE,0,RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR,palette.data(),0,sizeof(AffineSpace3f),palette.size());
+          rtcSetGeometryInstancedScene(instance_array,bl_scene);
+          rtcCommitGeometry(instance_array);
+          rtcAttachGeometry(scene,instance_array);
+          rtcReleaseGeometry(instance_array);
+          rtcCommitScene(scene);
+          return scene;
+        };
+        RTCSceneRef scene0 = createScene(true);
+        RTCSceneRef scene1 = createScene(false);
+        AssertNoError(device);
+
+        for (unsigned int i=0; i<numInstances; i++)
+        {
+          AffineSpace3fa xfm;
+          rtcGetGeometryTransformEx(rtcGetGeometry(scene0,0),i,0.0f,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,&xfm);
+          if (reduce_max(abs(xfm.p-reference[0][i].p)) > 1E-5f) return VerifyApplication::FAILED;
+          if (reduce_max(abs(xfm.l.vx-reference[0][i].l.vx)) > 1E-5f) return VerifyApplication::FAILED;
+          if (reduce_max(abs(xfm.l.vz-reference[0][i].l.vz)) > 1E-5f) return VerifyApplication::FAILED;
+        }
+
+        for (size_t i=0; i<1024; i++)
+        {
+          const unsigned int target = min((unsigned int)(numInstances*random_float()),numInstances-1);
+          const Vec3fa org = 24.0f*random_Vec3fa()-Vec3fa(12.0f);
+          const Vec3fa dir = reference[0][target].p + 0.2f*random_Vec3fa()-Vec3fa(0.1f) - org;
+          RTCRayHit ray0 = makeRay(org,dir); ray0.ray.time = random_float();
+          RTCRayHit ray1 = ray0;
+          rtcIntersect1(scene0,&ray0);
+          rtcIntersect1(scene1,&ray1);
+          if (ray0.hit.instPrimID[0] != ray1.hit.instPrimID[0]) return VerifyApplication::FAILED;
+          if (ray0.hit.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+          if (abs(ray0.ray.tfar-ray1.ray.tfar) > 1E-4f*ray1.ray.tfar) return VerifyApplication::FAILED;
+        }
+        AssertNoError(device);
+      }
+      return VerifyApplication::PASSED;
+    }
+  };
+
 #endif
 
   struct InactiveRaysTest : public VerifyApplication::IntersectTest
@@ -3748,7 +5044,132 @@ namespace embree
       return VerifyApplication::PASSED;
     }
   };
-  
+
+  struct TileTraversalTest : public VerifyApplication::IntersectTest
+  {
+    ALIGNED_STRUCT_(16);
+    SceneFlags sflags;
+    std::string model;
+    static const size_t tileSize = 16;
+
+    TileTraversalTest (std::string name, int isa, SceneFlags sflags, IntersectMode imode, IntersectVariant ivariant, std::string model)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), model(model) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      VerifyScene scene(device,sflags);
+      if      (model == "sphere.triangles") scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createTriangleSphere(zero,2.0f,50));
+      else if (model == "sphere.quads"    ) scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createQuadSphere    (zero,2.0f,50));
+      else if (model == "sphere.grids"    ) scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createGridSphere    (zero,2.0f,50));
+      else throw std::runtime_error("unsupported mode "+model);
+      rtcCommitScene (scene);
+      AssertNoError(device);
+
+      /* trace a tile of camera rays with the tile API and compare against single rays */
+      size_t numTests = 0;
+      size_t numFailures = 0;
+      for (size_t i=0; i<size_t(4*state->intensity); i++)
+      {
+        const Vec3fa org = Vec3fa(0.0f,0.0f,-5.0f) + 0.1f*(2.0f*random_Vec3fa() - Vec3fa(1.0f));
+        const Vec3fa corner = Vec3fa(-1.0f,-1.0f,1.0f) + 0.5f*random_Vec3fa();
+        const float scale = 0.1f + random_float();
+
+        __aligned(16) RTCRayHit rays0[tileSize*tileSize];
+        __aligned(16) RTCRayHit rays1[tileSize*tileSize];
+        for (size_t y=0; y<tileSize; y++) {
+          for (size_t x=0; x<tileSize; x++) {
+            const Vec3fa dir = corner + scale*Vec3fa(2.0f*float(x)/float(tileSize),2.0f*float(y)/float(tileSize),0.0f);
+            rays0[y*tileSize+x] = rays1[y*tileSize+x] = makeRay(org,dir);
+          }
+        }
+        IntersectWithMode    (MODE_INTERSECT1,ivariant,scene,rays0,tileSize*tileSize);
+        IntersectTileWithMode(imode,          ivariant,scene,rays1,tileSize*tileSize);
+
+        for (size_t j=0; j<tileSize*tileSize; j++)
+        {
+          numTests++;
+          if (ivariant & VARIANT_INTERSECT) {
+            if (rays0[j].hit.geomID != rays1[j].hit.geomID) numFailures++;
+            else if (rays0[j].hit.geomID != RTC_INVALID_GEOMETRY_ID)
+              numFailures += abs(rays0[j].ray.tfar - rays1[j].ray.tfar) > 16.0f*float(ulp)*abs(rays0[j].ray.tfar);
+          }
+          else
+            numFailures += rays0[j].ray.tfar != rays1[j].ray.tfar;
+        }
+      }
+      AssertNoError(device);
+
+      /* rays grazing the silhouette may legitimately differ between single rays and packets */
+      double failRate = double(numFailures) / double(max(size_t(1),numTests));
+      bool failed = failRate > 0.001;
+      if (!silent) { printf(" (%f%%)", 100.0f*failRate); fflush(stdout); }
+      return (VerifyApplication::TestReturnValue)(!failed);
+    }
+  };
+
+  struct TraversalContextTest : public VerifyApplication::Test
+  {
+    SceneFlags sflags;
+    std::string model;
+
+    TraversalContextTest (std::string name, int isa, SceneFlags sflags, std::string model)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), model(model) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      VerifyScene scene(device,sflags);
+      if      (model == "sphere.triangles") scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createTriangleSphere(zero,2.0f,50));
+      else if (model == "sphere.quads"    ) scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createQuadSphere    (zero,2.0f,50));
+      else if (model == "sphere.grids"    ) scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createGridSphere    (zero,2.0f,50));
+      else throw std::runtime_error("unsupported mode "+model);
+      rtcCommitScene (scene);
+      AssertNoError(device);
+
+      /* the traversal context has to give the same results as regular single ray queries, also after the scene got committed again */
+      size_t numFailures = 0;
+      RTCTraversalContext context;
+      for (size_t commit=0; commit<2; commit++)
+      {
+        if (commit == 1) {
+          scene.addGeometry(RTC_BUILD_QUALITY_MEDIUM,SceneGraph::createTriangleSphere(Vec3fa(0.0f,0.0f,-3.0f),0.5f,20));
+          rtcCommitScene (scene);
+          AssertNoError(device);
+        }
+        rtcInitTraversalContext(&context,scene);
+        AssertNoError(device);
+
+        for (size_t i=0; i<size_t(1000*state->intensity); i++)
+        {
+          const Vec3fa org = Vec3fa(0.0f,0.0f,-5.0f) + 0.1f*(2.0f*random_Vec3fa() - Vec3fa(1.0f));
+          const Vec3fa dir = 2.0f*random_Vec3fa() - Vec3fa(1.0f,1.0f,-1.0f);
+          __aligned(16) RTCRayHit ray0 = makeRay(org,dir);
+          __aligned(16) RTCRayHit ray1 = ray0;
+          rtcIntersect1(scene,&ray0);
+          rtcIntersectWithContext(&context,&ray1);
+          if (ray0.hit.geomID != ray1.hit.geomID || ray0.hit.primID != ray1.hit.primID || ray0.ray.tfar != ray1.ray.tfar)
+            numFailures++;
+
+          __aligned(16) RTCRay shadow0 = makeRay(org,dir).ray;
+          __aligned(16) RTCRay shadow1 = shadow0;
+          rtcOccluded1(scene,&shadow0);
+          rtcOccludedWithContext(&context,&shadow1);
+          if (shadow0.tfar != shadow1.tfar)
+            numFailures++;
+        }
+        AssertNoError(device);
+      }
+      return (VerifyApplication::TestReturnValue)(numFailures == 0);
+    }
+  };
+
   struct NaNTest : public VerifyApplication::IntersectTest
   {
     SceneFlags sflags;
@@ -3906,6 +5327,160 @@ namespace embree
   /////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////
   
+  struct PointQueryKNNTest : public VerifyApplication::Test
+  {
+    SceneFlags sflags; 
+
+    PointQueryKNNTest (std::string name, int isa, SceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcGetDeviceError(device));
+
+      const size_t numPoints = 1000;
+      const size_t numTriangles = 200;
+      const AffineSpace3fa xfm = AffineSpace3fa::translate(Vec3fa(0.5f,0.0f,0.0f)) * AffineSpace3fa::scale(Vec3fa(1.0f,2.0f,0.5f));
+
+      /* reference primitives in world space */
+      std::vector<Vec3fa> points;
+      std::vector<Vec3fa> instancedPoints;
+      std::vector<Vec3fa> triangles;
+
+      RTCSceneRef scene = rtcNewScene(device);
+      rtcSetSceneFlags(scene,sflags.sflags);
+      rtcSetSceneBuildQuality(scene,sflags.qflags);
+
+      RTCGeometry geom0 = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SPHERE_POINT);
+      rtcSetGeometryBuildQuality(geom0,sflags.qflags);
+      Vec4f* vertices0 = (Vec4f*) rtcSetNewGeometryBuffer(geom0, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT4, sizeof(Vec4f), numPoints);
+      for (size_t i=0; i<numPoints; i++) {
+        const Vec3fa p = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        vertices0[i] = Vec4f(p.x,p.y,p.z,0.01f);
+        points.push_back(p);
+      }
+      rtcCommitGeometry(geom0);
+      unsigned int geomID0 = rtcAttachGeometry(scene,geom0);
+      rtcReleaseGeometry(geom0);
+
+      RTCGeometry geom1 = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_TRIANGLE);
+      rtcSetGeometryBuildQuality(geom1,sflags.qflags);
+      Vec3f* vertices1 = (Vec3f*) rtcSetNewGeometryBuffer(geom1, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3, sizeof(Vec3f), 3*numTriangles);
+      Triangle* indices1 = (Triangle*) rtcSetNewGeometryBuffer(geom1, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3, sizeof(Triangle), numTriangles);
+      for (size_t i=0; i<numTriangles; i++) {
+        const Vec3fa p = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        for (size_t j=0; j<3; j++) {
+          const Vec3fa v = p + 0.1f*random_Vec3fa();
+          vertices1[3*i+j] = Vec3f(v.x,v.y,v.z);
+          triangles.push_back(v);
+        }
+        indices1[i] = Triangle(3*i+0,3*i+1,3*i+2);
+      }
+      rtcCommitGeometry(geom1);
+      unsigned int geomID1 = rtcAttachGeometry(scene,geom1);
+      rtcReleaseGeometry(geom1);
+
+      /* points instanced with an anisotropic transformation */
+      RTCSceneRef scene2 = rtcNewScene(device);
+      rtcSetSceneFlags(scene2,sflags.sflags);
+      rtcSetSceneBuildQuality(scene2,sflags.qflags);
+      RTCGeometry geom2 = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_SPHERE_POINT);
+      rtcSetGeometryBuildQuality(geom2,sflags.qflags);
+      Vec4f* vertices2 = (Vec4f*) rtcSetNewGeometryBuffer(geom2, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT4, sizeof(Vec4f), numPoints);
+      for (size_t i=0; i<numPoints; i++) {
+        const Vec3fa p = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        vertices2[i] = Vec4f(p.x,p.y,p.z,0.01f);
+        instancedPoints.push_back(xfmPoint(xfm,p));
+      }
+      rtcCommitGeometry(geom2);
+      rtcAttachGeometry(scene2,geom2);
+      rtcReleaseGeometry(geom2);
+      rtcCommitScene(scene2);
+
+      RTCGeometry instance = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_INSTANCE);
+      rtcSetGeometryInstancedScene(instance,scene2);
+      rtcSetGeometryTransform(instance,0,RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,(float*)&xfm);
+      rtcCommitGeometry(instance);
+      unsigned int instID = rtcAttachGeometry(scene,instance);
+      rtcReleaseGeometry(instance);
+      rtcCommitScene(scene);
+      AssertNoError(device);
+
+      const unsigned int maxK = 32;
+      std::vector<RTCPointQueryNeighbor> neighbors(maxK);
+      for (size_t i=0; i<size_t(100*state->intensity); i++)
+      {
+        const Vec3fa q = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        const unsigned int k = 1 + (unsigned int)random_int() % maxK;
+
+        /* brute force reference distances */
+        std::vector<float> distances;
+        for (const Vec3fa& p : points) distances.push_back(length(q-p));
+        for (const Vec3fa& p : instancedPoints) distances.push_back(length(q-p));
+        for (size_t j=0; j<numTriangles; j++)
+          distances.push_back(length(q-closestPointTriangle(q,triangles[3*j+0],triangles[3*j+1],triangles[3*j+2])));
+        std::sort(distances.begin(),distances.end());
+
+        RTCPointQuery query;
+        query.x = q.x; query.y = q.y; query.z = q.z;
+        query.time = 0.0f;
+        query.radius = inf;
+        const unsigned int num = rtcPointQueryKNN(scene,&query,k,neighbors.data());
+        AssertNoError(device);
+        if (num != k) return VerifyApplication::FAILED;
+
+        for (unsigned int j=0; j<num; j++)
+        {
+          const RTCPointQueryNeighbor& n = neighbors[j];
+          if (abs(n.distance - distances[j]) > 1E-4f*(1.0f+distances[j])) return VerifyApplication::FAILED;
+          if (abs(length(q-Vec3fa(n.x,n.y,n.z)) - n.distance) > 1E-4f*(1.0f+n.distance)) return VerifyApplication::FAILED;
+          const bool instanced = n.instID[0] != RTC_INVALID_GEOMETRY_ID;
+          if (instanced && (n.instID[0] != instID || n.geomID != 0)) return VerifyApplication::FAILED;
+          if (!instanced && n.geomID != geomID0 && n.geomID != geomID1) return VerifyApplication::FAILED;
+        }
+        if (query.radius != neighbors[k-1].distance) return VerifyApplication::FAILED;
+      }
+
+      /* the batched query has to match single queries */
+      __aligned(16) int valid4[4] = { -1, 0, -1, -1 };
+      __aligned(16) RTCPointQuery4 query4;
+      for (size_t j=0; j<4; j++) {
+        const Vec3fa q = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        query4.x[j] = q.x; query4.y[j] = q.y; query4.z[j] = q.z;
+        query4.time[j] = 0.0f;
+        query4.radius[j] = 0.5f;
+      }
+      std::vector<RTCPointQueryNeighbor> neighbors4(4*maxK);
+      unsigned int numNeighbors4[4];
+      rtcPointQueryKNN4(valid4,scene,&query4,maxK,neighbors4.data(),numNeighbors4);
+      AssertNoError(device);
+
+      for (size_t j=0; j<4; j++)
+      {
+        if (!valid4[j]) {
+          if (numNeighbors4[j] != 0) return VerifyApplication::FAILED;
+          continue;
+        }
+        RTCPointQuery query;
+        query.x = query4.x[j]; query.y = query4.y[j]; query.z = query4.z[j];
+        query.time = 0.0f;
+        query.radius = 0.5f;
+        const unsigned int num = rtcPointQueryKNN(scene,&query,maxK,neighbors.data());
+        if (num != numNeighbors4[j]) return VerifyApplication::FAILED;
+        for (unsigned int l=0; l<num; l++) {
+          if (neighbors[l].distance > 0.5f) return VerifyApplication::FAILED;
+          if (neighbors[l].distance != neighbors4[j*maxK+l].distance) return VerifyApplication::FAILED;
+        }
+      }
+      AssertNoError(device);
+
+      return VerifyApplication::PASSED;
+    }
+  };
+  
+
   struct PointQueryAPICallsTest : public VerifyApplication::Test
   {
     SceneFlags sflags; 
@@ -4155,7 +5730,7 @@ namespace embree
         rtcInitPointQueryContext(&context);
         uint32_t numCalls = 0;
         rtcPointQuery(scene, &query, &context, queryFunc, (void*)&numCalls);
-        if (numCalls != 0)
+        if (numCalls != 10)
         {
           return VerifyApplication::FAILED;
         }
@@ -6218,6 +7793,31 @@ namespace embree
       }
       groups.pop();
 
+      groups.top()->add(new SubdivTopologyUpdateTest("subdiv_topology_update",isa));
+      groups.top()->add(new AdaptiveTessellationTest("subdiv_adaptive_tessellation",isa));
+      groups.top()->add(new CurveLODTest("curve_lod",isa));
+      groups.top()->add(new CurveSplitBuildTest("curve_split_build.round_bezier",isa,RTC_GEOMETRY_TYPE_ROUND_BEZIER_CURVE));
+      groups.top()->add(new CurveSplitBuildTest("curve_split_build.flat_bezier",isa,RTC_GEOMETRY_TYPE_FLAT_BEZIER_CURVE));
+      groups.top()->add(new CurveSplitBuildTest("curve_split_build.round_bspline",isa,RTC_GEOMETRY_TYPE_ROUND_BSPLINE_CURVE));
+      groups.top()->add(new CurveSplitBuildTest("curve_split_build.flat_catmull_rom",isa,RTC_GEOMETRY_TYPE_FLAT_CATMULL_ROM_CURVE));
+      groups.top()->add(new CurveRibbonPackedTest("curve_ribbon_packed.flat_bezier_1",isa,RTC_GEOMETRY_TYPE_FLAT_BEZIER_CURVE,1));
+      groups.top()->add(new CurveRibbonPackedTest("curve_ribbon_packed.flat_bezier_2",isa,RTC_GEOMETRY_TYPE_FLAT_BEZIER_CURVE,2));
+      groups.top()->add(new CurveRibbonPackedTest("curve_ribbon_packed.flat_bspline_2",isa,RTC_GEOMETRY_TYPE_FLAT_BSPLINE_CURVE,2));
+      groups.top()->add(new CurveRibbonPackedTest("curve_ribbon_packed.flat_catmull_rom_4",isa,RTC_GEOMETRY_TYPE_FLAT_CATMULL_ROM_CURVE,4));
+      groups.top()->add(new PointMortonBuildTest("point_morton_build.sphere",isa,RTC_GEOMETRY_TYPE_SPHERE_POINT));
+      groups.top()->add(new PointMortonBuildTest("point_morton_build.disc",isa,RTC_GEOMETRY_TYPE_DISC_POINT));
+      groups.top()->add(new PointMortonBuildTest("point_morton_build.oriented_disc",isa,RTC_GEOMETRY_TYPE_ORIENTED_DISC_POINT));
+      groups.top()->add(new GridHoleTest("grid_holes",isa));
+      groups.top()->add(new MotionBlurRefitTest("motion_blur_refit",isa));
+      groups.top()->add(new UserGeometryBatchTest("user_geometry_batch",isa));
+      groups.top()->add(new AlphaMaskTest("alpha_mask_triangle_bit",isa,RTC_GEOMETRY_TYPE_TRIANGLE,RTC_ALPHA_MASK_FORMAT_BIT));
+      groups.top()->add(new AlphaMaskTest("alpha_mask_triangle_uchar",isa,RTC_GEOMETRY_TYPE_TRIANGLE,RTC_ALPHA_MASK_FORMAT_UCHAR));
+      groups.top()->add(new AlphaMaskTest("alpha_mask_quad_bit",isa,RTC_GEOMETRY_TYPE_QUAD,RTC_ALPHA_MASK_FORMAT_BIT));
+      groups.top()->add(new AlphaMaskTest("alpha_mask_quad_uchar",isa,RTC_GEOMETRY_TYPE_QUAD,RTC_ALPHA_MASK_FORMAT_UCHAR));
+  #if defined(EMBREE_GEOMETRY_INSTANCE_ARRAY)
+      groups.top()->add(new CubicInstanceMotionTest("cubic_instance_motion",isa));
+  #endif
+
 #if !defined(TASKING_PPL) // FIXME: PPL has some issues here!
       groups.top()->add(new GarbageGeometryTest("build_garbage_geom",isa));
 #endif
@@ -6261,6 +7861,8 @@ namespace embree
       for (auto s : interpolateTests)
         groups.top()->add(new InterpolateSubdivTest(std::to_string((long long)(s)),isa,s));
       groups.pop();
+
+      groups.top()->add(new TessellationCacheStatsTest("tessellation_cache_stats",isa));
         
       push(new TestGroup("hair",true,true));
       for (auto s : interpolateTests) 
@@ -6289,6 +7891,13 @@ namespace embree
                 groups.top()->add(new QuadHitTest(to_string(sflags,imode,ivariant),isa,sflags,RTC_BUILD_QUALITY_MEDIUM,imode,ivariant));
       groups.pop();
 
+      push(new TestGroup("lazy_subdiv",true,true));
+      for (auto imode : intersectModes) 
+        for (auto ivariant : intersectVariants)
+          if (has_variant(imode,ivariant))
+            groups.top()->add(new LazySubdivTest(to_string(imode,ivariant),isa,imode,ivariant));
+      groups.pop();
+
       if (rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_RAY_MASK_SUPPORTED)) 
       {
         push(new TestGroup("ray_masks",true,true));
@@ -6358,6 +7967,9 @@ namespace embree
                 groups.top()->add(new InstanceArrayRandomTest<RTCQuaternionDecomposition>("instancing_random_SRT."+to_string(sflags,imode,ivariant),isa,sflags,RTC_BUILD_QUALITY_MEDIUM,imode,ivariant));
                 groups.top()->add(new InstanceArrayTestFormats("instancing_format."+to_string(sflags,imode,ivariant),isa,sflags,RTC_BUILD_QUALITY_MEDIUM,imode,ivariant));
               }
+        groups.top()->add(new InstanceArrayCompressedTest("compressed_translation",isa,RTC_FORMAT_TRANSLATION_FLOAT3));
+        groups.top()->add(new InstanceArrayCompressedTest("compressed_translation_palette",isa,RTC_FORMAT_TRANSLATION_PALETTE_INDEX));
+        groups.top()->add(new InstanceArrayCompressedTest("compressed_half3x4",isa,RTC_FORMAT_HALF3X4_COLUMN_MAJOR));
       groups.pop();
 #endif
 
@@ -6458,6 +8070,25 @@ namespace embree
         groups.pop();
       }
 
+      push(new TestGroup("tile_traversal",true,true)); {
+        std::string tileModels [] = {"sphere.triangles", "sphere.quads", "sphere.grids" };
+        for (auto sflags : sceneFlagsRobust)
+          for (auto imode : intersectModes)
+            for (auto ivariant : intersectVariants)
+              if (imode != MODE_INTERSECT1 && has_variant(imode,ivariant) && (ivariant & VARIANT_INTERSECT_OCCLUDED) != VARIANT_INTERSECT_OCCLUDED)
+                for (std::string model : tileModels)
+                  groups.top()->add(new TileTraversalTest(to_string(sflags,imode,ivariant)+"."+model,isa,sflags,imode,ivariant,model));
+        groups.pop();
+      }
+
+      push(new TestGroup("traversal_context",true,true)); {
+        std::string contextModels [] = {"sphere.triangles", "sphere.quads", "sphere.grids" };
+        for (auto sflags : sceneFlags)
+          for (std::string model : contextModels)
+            groups.top()->add(new TraversalContextTest(to_string(sflags)+"."+model,isa,sflags,model));
+        groups.pop();
+      }
+
       if (rtcGetDeviceProperty(device,RTC_DEVICE_PROPERTY_IGNORE_INVALID_RAYS_ENABLED))
       {
         push(new TestGroup("nan_test",true,false));
@@ -6484,6 +8115,7 @@ namespace embree
       push(new TestGroup("point_query",true,true));
       for (auto sflags : sceneFlags) {
         groups.top()->add(new PointQueryAPICallsTest("point_query_api_calls",isa,sflags));
+        groups.top()->add(new PointQueryKNNTest("knn."+to_string(sflags),isa,sflags));
         if (stringOfISA(isa) == "SSE4.1" || stringOfISA(isa) == "SSE4.2") {
           groups.top()->add(new PointQueryTest(to_string(sflags),isa,sflags,"bvh4.triangle4v"));
           groups.top()->add(new PointQueryTest(to_string(sflags),isa,sflags,"bvh4.triangle4i"));
@@ -6588,6 +8220,23 @@ namespace embree
             groups.top()->add(new IncoherentRaysBenchmark("incoherent."+to_string(gtype)+"_1000k."+to_string(sflags.first,imode.first,imode.second),
                                                           isa,gtype,sflags.first,sflags.second,imode.first,imode.second,501));
 
+      /* single ray traversal benchmarks, the name encodes how hit children are ordered
+       * during traversal to compare builds with and without EMBREE_BVH_OCTANT_ORDER */
+#if defined(EMBREE_BVH_OCTANT_ORDER)
+      const std::string traversal_order = "octant_order";
+#else
+      const std::string traversal_order = "sorted";
+#endif
+      GeometryType benchmark_traversal_gtypes[] = { TRIANGLE_MESH, QUAD_MESH };
+      for (auto gtype : benchmark_traversal_gtypes)
+        for (auto& sflags : benchmark_sflags_quality)
+        {
+          groups.top()->add(new CoherentRaysBenchmark("traversal."+traversal_order+".coherent."+to_string(gtype)+"_1000k."+to_string(sflags.first,MODE_INTERSECT1,VARIANT_INTERSECT),
+                                                      isa,gtype,sflags.first,sflags.second,MODE_INTERSECT1,VARIANT_INTERSECT,501));
+          groups.top()->add(new IncoherentRaysBenchmark("traversal."+traversal_order+".incoherent."+to_string(gtype)+"_1000k."+to_string(sflags.first,MODE_INTERSECT1,VARIANT_INTERSECT),
+                                                        isa,gtype,sflags.first,sflags.second,MODE_INTERSECT1,VARIANT_INTERSECT,501));
+        }
+
       std::vector<std::pair<SceneFlags,RTCBuildQuality>> benchmark_create_sflags_quality;
       benchmark_create_sflags_quality.push_back(std::make_pair(SceneFlags(RTC_SCENE_FLAG_NONE,RTC_BUILD_QUALITY_MEDIUM),RTC_BUILD_QUALITY_MEDIUM));
       benchmark_create_sflags_quality.push_back(std::make_pair(SceneFlags(RTC_SCENE_FLAG_DYNAMIC,RTC_BUILD_QUALITY_LOW),RTC_BUILD_QUALITY_LOW));